@@ -0,0 +1,383 @@
+/*	$OpenBSD$	*/
+
+/*
+ * Copyright (c) 2019 Reyk Floeter <reyk@openbsd.org>
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Generate the Huffman decoding tables and the flat Huffman tree of
+ * hpack_huffman.h from the Huffman code in hpack.h, or the perfect
+ * hash of the static table names of hpack_static.h with -s.
+ */
+
+#include <sys/types.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <err.h>
+
+#define HPACK_INTERNAL
+#include "hpack.h"
+
+struct node {
+	struct node	*zero;
+	struct node	*one;
+	int		 sym;
+	int		 id;
+};
+
+static struct node	*node_new(void);
+static int		 node_number(struct node *, int, int, int *);
+static void		 gen_tree(void);
+static void		 gen_states(struct node *);
+static void		 gen_fast(struct node *);
+static void		 gen_huffman(void);
+static unsigned int	 static_hash(const char *, unsigned int,
+			    unsigned int, unsigned int);
+static void		 gen_static(void);
+static __dead void	 usage(void);
+
+static struct node	*nodes[HPACK_HUFFMAN_STATES];
+static unsigned char	 accept[HPACK_HUFFMAN_STATES];
+
+static struct node *
+node_new(void)
+{
+	struct node	*node;
+
+	if ((node = calloc(1, sizeof(*node))) == NULL)
+		err(1, "calloc");
+	node->sym = node->id = -1;
+
+	return (node);
+}
+
+static int
+node_number(struct node *node, int depth, int ones, int *id)
+{
+	if (node == NULL)
+		return (-1);
+	if (node->sym != -1)
+		return (0);
+	if (*id >= HPACK_HUFFMAN_STATES)
+		return (-1);
+
+	/*
+	 * The root is state 0.  A state is accepting at the end of the
+	 * input if it has only consumed up to 7 bits of EOS padding.
+	 */
+	node->id = *id;
+	nodes[*id] = node;
+	accept[*id] = ones && depth < 8;
+	(*id)++;
+
+	if (node_number(node->zero, depth + 1, 0, id) == -1 ||
+	    node_number(node->one, depth + 1, ones, id) == -1)
+		return (-1);
+
+	return (0);
+}
+
+static void
+gen_tree(void)
+{
+	struct node	*child;
+	unsigned int	 i, j, val;
+
+	printf("static const struct hpack_huffman_node\n"
+	    "    huffman_decode_tree[HPACK_HUFFMAN_STATES] = {");
+
+	for (i = 0; i < HPACK_HUFFMAN_STATES; i++) {
+		printf("%s{{", i % 4 ? " " : "\n\t");
+		for (j = 0; j < 2; j++) {
+			child = j ? nodes[i]->one : nodes[i]->zero;
+			if (child->sym != -1)
+				val = HPACK_HUFFMAN_F_LEAF | child->sym;
+			else
+				val = child->id;
+			printf("%s0x%04x", j ? "," : "", val);
+		}
+		printf("}},");
+	}
+	printf("\n};\n");
+}
+
+static void
+gen_states(struct node *root)
+{
+	struct hpack_huffman_state	 hps;
+	struct node			*node;
+	unsigned int			 i, j, bits;
+
+	printf("static const struct hpack_huffman_state\n"
+	    "    huffman_decode_states[HPACK_HUFFMAN_STATES][16] = {\n");
+
+	for (i = 0; i < HPACK_HUFFMAN_STATES; i++) {
+		printf("\t/* state %u */\n\t{", i);
+		for (bits = 0; bits < 16; bits++) {
+			memset(&hps, 0, sizeof(hps));
+			node = nodes[i];
+
+			/* Walk the tree for the 4 bits of this transition */
+			for (j = 4; j > 0; j--) {
+				node = ((bits >> (j - 1)) & 1) ?
+				    node->one : node->zero;
+				if (node->sym == -1)
+					continue;
+
+				/* EOS must not be part of the encoded string */
+				if (node->sym == HPACK_HUFFMAN_SIZE - 1) {
+					hps.hps_flags = HPACK_HUFFMAN_F_FAIL;
+					break;
+				}
+
+				/* Symbols are at least 5 bits, so one per step */
+				hps.hps_flags |= HPACK_HUFFMAN_F_EMIT;
+				hps.hps_sym = (unsigned char)node->sym;
+				hps.hps_bits = 5 - j;
+				node = root;
+			}
+			if ((hps.hps_flags & HPACK_HUFFMAN_F_FAIL) == 0) {
+				hps.hps_state = (unsigned char)node->id;
+				if (accept[node->id])
+					hps.hps_flags |= HPACK_HUFFMAN_F_ACCEPT;
+			}
+
+			printf("%s{%3u,0x%x,%3u,%u},",
+			    bits % 4 ? " " : "\n\t    ",
+			    hps.hps_state, hps.hps_flags,
+			    hps.hps_sym, hps.hps_bits);
+		}
+		printf("\n\t},\n");
+	}
+	printf("};\n");
+}
+
+static void
+gen_fast(struct node *root)
+{
+	struct hpack_huffman_fast	 hpf;
+	struct node			*node;
+	unsigned int			 i, j, n;
+
+	printf("static const struct hpack_huffman_fast\n"
+	    "    huffman_decode_fast[1 << HPACK_HUFFMAN_FAST_BITS] = {");
+
+	for (i = 0; i < (1 << HPACK_HUFFMAN_FAST_BITS); i++) {
+		memset(&hpf, 0, sizeof(hpf));
+		node = root;
+
+		for (j = 0, n = 0; j < HPACK_HUFFMAN_FAST_BITS; j++) {
+			node = ((i >> (HPACK_HUFFMAN_FAST_BITS - j - 1)) & 1) ?
+			    node->one : node->zero;
+			if (node->sym == -1)
+				continue;
+
+			/* EOS is longer than the lookup */
+			hpf.hpf_sym[n] = (unsigned char)node->sym;
+			hpf.hpf_bits[n] = j + 1;
+			node = root;
+			if (++n == 2)
+				break;
+		}
+
+		/* Prefix of a long code, continue with the state machine */
+		if (n == 0)
+			hpf.hpf_sym[0] = (unsigned char)node->id;
+
+		printf("%s{{%3u,%3u},{%2u,%2u}},",
+		    i % 3 ? " " : "\n\t",
+		    hpf.hpf_sym[0], hpf.hpf_sym[1],
+		    hpf.hpf_bits[0], hpf.hpf_bits[1]);
+	}
+	printf("\n};\n");
+}
+
+static unsigned int
+static_hash(const char *name, unsigned int a, unsigned int b,
+    unsigned int size)
+{
+	size_t		 len = strlen(name);
+
+	/* Needs to match HPACK_STATIC_HASH() in hpack.h */
+	return ((len + (name[0] | 0x20) * a +
+	    (name[len - 1] | 0x20) * b) & (size - 1));
+}
+
+static void
+gen_static(void)
+{
+	struct hpack_index	*id, *first;
+	unsigned char		 used[HPACK_STATIC_HASH_MAX];
+	unsigned int		 a, b, size, h, i, n;
+
+	/* Find the smallest hash table without collisions */
+	for (size = 32; size <= HPACK_STATIC_HASH_MAX; size *= 2) {
+		for (a = 1; a < 256; a++) {
+			for (b = 1; b < 256; b++) {
+				memset(used, 0, sizeof(used));
+				for (i = 0; i < HPACK_STATIC_SIZE; i++) {
+					id = &static_table[i];
+					if (i > 0 && strcmp(id->hpi_name,
+					    static_table[i - 1].hpi_name) == 0)
+						continue;
+					h = static_hash(id->hpi_name,
+					    a, b, size);
+					if (used[h]++)
+						break;
+				}
+				if (i == HPACK_STATIC_SIZE)
+					goto found;
+			}
+		}
+	}
+	errx(1, "no perfect hash for the static table");
+
+ found:
+	printf("/*\n"
+	    " * THIS FILE IS AUTOMATICALLY GENERATED BY gen/hpackgen.c"
+	    " - DO NOT EDIT.\n"
+	    " *\n"
+	    " * Perfect hash of the names in the HPACK static table"
+	    " in hpack.h,\n"
+	    " * regenerate it with \"make tables\" in gen/.\n"
+	    " */\n\n"
+	    "#ifndef HPACK_STATIC_H\n"
+	    "#define HPACK_STATIC_H\n\n"
+	    "#define HPACK_STATIC_HASH_A\t%u\n"
+	    "#define HPACK_STATIC_HASH_B\t%u\n"
+	    "#define HPACK_STATIC_HASH_SIZE\t%u\n\n", a, b, size);
+
+	/* Map each name to its first index and the number of entries */
+	printf("static const struct hpack_static_name\n"
+	    "    static_names[HPACK_STATIC_HASH_SIZE] = {");
+	for (h = 0; h < size; h++) {
+		for (i = 0, n = 0, first = NULL; i < HPACK_STATIC_SIZE; i++) {
+			id = &static_table[i];
+			if (static_hash(id->hpi_name, a, b, size) != h)
+				continue;
+			if (n++ == 0)
+				first = id;
+		}
+		printf("%s{%2ld,%u,%2zu},", h % 4 ? " " : "\n\t",
+		    first == NULL ? 0 : first->hpi_id, n,
+		    first == NULL ? 0 : strlen(first->hpi_name));
+	}
+	printf("\n};\n\n");
+
+	/* The lengths and the token, the first index of the name */
+	printf("static const struct hpack_static_length\n"
+	    "    static_lengths[HPACK_STATIC_SIZE] = {");
+	for (i = 0, first = NULL; i < HPACK_STATIC_SIZE; i++) {
+		id = &static_table[i];
+		if (first == NULL || strcmp(first->hpi_name, id->hpi_name) != 0)
+			first = id;
+		printf("%s{%2zu,%2zu,%2ld},", i % 6 ? " " : "\n\t",
+		    strlen(id->hpi_name),
+		    id->hpi_value == NULL ? 0 : strlen(id->hpi_value),
+		    first->hpi_id);
+	}
+	printf("\n};\n\n"
+	    "#endif /* HPACK_STATIC_H */\n");
+}
+
+static void
+gen_huffman(void)
+{
+	struct hpack_huffman	*hph;
+	struct node		*root, *cur;
+	unsigned int		 i, j;
+	int			 id = 0;
+
+	/* Create the Huffman tree */
+	root = node_new();
+	for (i = 0; i < HPACK_HUFFMAN_SIZE; i++) {
+		hph = &huffman_table[i];
+		cur = root;
+		for (j = hph->hph_length; j > 0; j--) {
+			if ((hph->hph_code >> (j - 1)) & 1) {
+				if (cur->one == NULL)
+					cur->one = node_new();
+				cur = cur->one;
+			} else {
+				if (cur->zero == NULL)
+					cur->zero = node_new();
+				cur = cur->zero;
+			}
+		}
+		cur->sym = i;
+	}
+
+	/* Number the internal nodes as decoding states */
+	if (node_number(root, 0, 1, &id) == -1 ||
+	    id != HPACK_HUFFMAN_STATES)
+		errx(1, "invalid Huffman code");
+
+	printf("/*\n"
+	    " * THIS FILE IS AUTOMATICALLY GENERATED BY gen/hpackgen.c"
+	    " - DO NOT EDIT.\n"
+	    " *\n"
+	    " * Huffman decoding tables of the HPACK Huffman code"
+	    " in hpack.h,\n"
+	    " * regenerate them with \"make tables\" in gen/.\n"
+	    " */\n\n"
+	    "#ifndef HPACK_HUFFMAN_H\n"
+	    "#define HPACK_HUFFMAN_H\n\n"
+	    "#ifdef HPACK_HUFFMAN_TREE\n");
+	gen_tree();
+	printf("#else\n");
+	gen_states(root);
+	printf("\n");
+	gen_fast(root);
+	printf("#endif /* HPACK_HUFFMAN_TREE */\n"
+	    "\n#endif /* HPACK_HUFFMAN_H */\n");
+}
+
+static __dead void
+usage(void)
+{
+	extern char	*__progname;
+
+	fprintf(stderr, "usage: %s [-s]\n", __progname);
+	exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+	int		 ch, sflag = 0;
+
+	while ((ch = getopt(argc, argv, "s")) != -1) {
+		switch (ch) {
+		case 's':
+			sflag = 1;
+			break;
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	if (argc != 0)
+		usage();
+
+	if (sflag)
+		gen_static();
+	else
+		gen_huffman();
+
+	return (0);
+}
@@ -17,16 +17,26 @@
  */
 
 #include <sys/types.h>
+#include <sys/uio.h>
+
+#include <arpa/inet.h>
 
 #include <stdio.h>
 #include <string.h>
+#include <ctype.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <limits.h>
+#include <errno.h>
+#include <stdint.h>
 #include <math.h>
 #include <err.h>
 
 #define HPACK_INTERNAL
 #include "hpack.h"
+#include "hpack_huffman.h"
+#include "hpack_static.h"
 
 static const struct hpack_index *
 		 hpack_table_getbyid(long, struct hpack_index *,
@@ -34,48 +44,93 @@ static const struct hpack_index *
 static const struct hpack_index *
 		 hpack_table_getbyheader(struct hpack_header *,
 		    struct hpack_index *, struct hpack_table *);
+static const struct hpack_index *
+		 hpack_table_getstatic(struct hpack_header *,
+		    struct hpack_index *);
+static const struct hpack_static_name *
+		 hpack_table_getname(const char *, size_t);
+static enum hpack_header_token
+		 hpack_table_token(const char *, size_t);
+static struct hpack_entry *
+		 hpack_table_entry(long, struct hpack_table *);
+static unsigned int
+		 hpack_table_hash(const char *, size_t, const char *, size_t);
+static void	 hpack_table_link(struct hpack_entry *,
+		    struct hpack_table *);
 static int	 hpack_table_add(struct hpack_header *,
 		    struct hpack_table *);
+static int	 hpack_table_alloc(struct hpack_table *);
 static int	 hpack_table_evict(long, long, struct hpack_table *);
 static int	 hpack_table_setsize(long, struct hpack_table *);
 
+static char	*hpack_string_new(const char *, size_t);
+static char	*hpack_string_ref(const char *);
+static void	 hpack_string_free(const char *);
+
 static long	 hpack_decode_int(struct hbuf *, unsigned char);
-static char	*hpack_decode_str(struct hbuf *, unsigned char);
+static int	 hpack_decode_skip(unsigned char, unsigned char *, size_t,
+		    size_t *, struct hpack_table *);
+static char	*hpack_decode_str(struct hbuf *, unsigned char,
+		    struct hpack_table *, size_t *, int *, unsigned char *);
+static void	 hpack_decode_check(struct hpack_header *,
+		    struct hpack_table *);
 static int	 hpack_decode_buf(struct hbuf *, struct hpack_table *);
+static int	 hpack_decode_block(unsigned char *, size_t,
+		    struct hpack_table *);
+static int	 hpack_decode_end(struct hpack_table *, int);
+static int	 hpack_decode_pending(unsigned char **, size_t *,
+		    struct hpack_table *);
+static int	 hpack_decode_scan(struct hbuf *, int, size_t *, int *,
+		    struct hpack_table *);
+static int	 hpack_decode_drop(struct hbuf *, size_t, size_t, int,
+		    struct hpack_table *);
+static void	 hpack_header_release(struct hpack_header *);
+static void	*hpack_arena_alloc(struct hpack_arena *, size_t);
+static void	*hpack_arena_pos(struct hpack_arena *);
+static void	 hpack_arena_trim(struct hpack_arena *, void *, size_t);
+static char	*hpack_arena_strdup(struct hpack_arena *, const char *,
+		    size_t);
 static long	 hpack_decode_index(struct hbuf *, unsigned char,
 		    const struct hpack_index **, struct hpack_table *);
 static int	 hpack_decode_literal(struct hbuf *, unsigned char,
 		    struct hpack_table *);
+static int	 hpack_encode_hdr(struct hbuf *, struct hpack_header *,
+		    struct hpack_table *);
+static void	 hpack_encode_lengths(const struct hpack_header *, size_t *,
+		    size_t *);
+static size_t	 hpack_encode_hdrmaxlen(const struct hpack_header *,
+		    struct hpack_table *);
 static int	 hpack_encode_int(struct hbuf *, long, unsigned char,
 		    unsigned char);
-static int	 hpack_encode_str(struct hbuf *, char *);
+static size_t	 hpack_encode_intlen(size_t, unsigned char);
+static int	 hpack_encode_str(struct hbuf *, const char *, size_t);
+
+static void	 hpack_huffman_write(const unsigned char *, size_t,
+		    unsigned char *);
+static ssize_t	 hpack_huffman_decode_class(const unsigned char *, size_t,
+		    unsigned char *, size_t, unsigned char *);
 
-static int	 hpack_huffman_init(void);
-static struct hpack_huffman_node *
-		 hpack_huffman_new(void);
-static void	 hpack_huffman_free(struct hpack_huffman_node *);
 
 static struct hbuf *
 		 hbuf_new(unsigned char *, size_t);
 static void	 hbuf_free(struct hbuf *);
 static int	 hbuf_writechar(struct hbuf *, unsigned char);
-static int	 hbuf_writebuf(struct hbuf *, unsigned char *, size_t);
+static int	 hbuf_writebuf(struct hbuf *, const unsigned char *,
+		    size_t);
+static int	 hbuf_reserve(struct hbuf *, unsigned char **, size_t);
 static unsigned char *
 		 hbuf_release(struct hbuf *, size_t *);
 static int	 hbuf_readchar(struct hbuf *, unsigned char *);
 static int	 hbuf_readbuf(struct hbuf *, unsigned char **, size_t);
 static int	 hbuf_advance(struct hbuf *, size_t);
 static size_t	 hbuf_left(struct hbuf *);
-
-static struct hpack	 hpack_global;
+static void	 hbuf_view(struct hbuf *, unsigned char *, size_t);
+static void	 hbuf_fixed(struct hbuf *, unsigned char *, size_t);
 
 int
 hpack_init(void)
 {
-	/* Initialize the huffman tree */
-	if (hpack_huffman_init() == -1)
-		return (-1);
-
+	/* The Huffman tables are generated at build time */
 	return (0);
 }
 
@@ -96,6 +151,9 @@ hpack_header_add(struct hpack_headerblock *hdrs, const char *name,
 	hdr->hdr_name = strdup(name);
 	hdr->hdr_value = strdup(value);
 	hdr->hdr_index = index;
+	hdr->hdr_namelen = strlen(name);
+	hdr->hdr_token = hpack_table_token(name, hdr->hdr_namelen);
+	hdr->hdr_valuelen = strlen(value);
 	if (hdr->hdr_name == NULL || hdr->hdr_value == NULL) {
 		hpack_header_free(hdr);
 		return (NULL);
@@ -110,11 +168,23 @@ hpack_header_free(struct hpack_header *hdr)
 {
 	if (hdr == NULL)
 		return;
-	free(hdr->hdr_name);
-	free(hdr->hdr_value);
+	hpack_header_release(hdr);
 	free(hdr);
 }
 
+static void
+hpack_header_release(struct hpack_header *hdr)
+{
+	if (hdr->hdr_flags & HPACK_HEADER_F_NAME_SHARED)
+		hpack_string_free(hdr->hdr_name);
+	else if ((hdr->hdr_flags & HPACK_HEADER_F_NAME_BORROWED) == 0)
+		free(HPACK_UNCONST(hdr->hdr_name));
+	if (hdr->hdr_flags & HPACK_HEADER_F_VALUE_SHARED)
+		hpack_string_free(hdr->hdr_value);
+	else if ((hdr->hdr_flags & HPACK_HEADER_F_VALUE_BORROWED) == 0)
+		free(HPACK_UNCONST(hdr->hdr_value));
+}
+
 struct hpack_headerblock *
 hpack_headerblock_new(void)
 {
@@ -136,6 +206,7 @@ hpack_headerblock_free(struct hpack_headerblock *hdrs)
 		TAILQ_REMOVE(hdrs, hdr, hdr_entry);
 		hpack_header_free(hdr);
 	}
+	free(hdrs);
 }
 
 struct hpack_table *
@@ -145,10 +216,6 @@ hpack_table_new(size_t max_table_size)
 
 	if ((hpack = calloc(1, sizeof(*hpack))) == NULL)
 		return (NULL);
-	if ((hpack->htb_dynamic = hpack_headerblock_new()) == NULL) {
-		free(hpack);
-		return (NULL);
-	}
 	hpack->htb_max_table_size = hpack->htb_table_size =
 	    max_table_size == 0 ? HPACK_MAX_TABLE_SIZE : max_table_size;
 
@@ -160,19 +227,33 @@ hpack_table_free(struct hpack_table *hpack)
 {
 	if (hpack == NULL)
 		return;
-	hpack_headerblock_free(hpack->htb_dynamic);
+	hpack_table_evict(0, 0, hpack);
+	free(hpack->htb_dynamic);
+	hbuf_free(hpack->htb_pending);
 	free(hpack);
 }
 
+static struct hpack_entry *
+hpack_table_entry(long index, struct hpack_table *hpack)
+{
+	size_t		 slot;
+
+	/* The dynamic index starts with the newest entry at 0 */
+	slot = hpack->htb_dynamic_first +
+	    (size_t)(hpack->htb_dynamic_entries - 1 - index);
+
+	return (&hpack->htb_dynamic[slot & (hpack->htb_dynamic_slots - 1)]);
+}
+
 static const struct hpack_index *
 hpack_table_getbyid(long index, struct hpack_index *idbuf,
     struct hpack_table *hpack)
 {
 	struct hpack_index		*id = NULL;
-	struct hpack_header		*hdr;
+	struct hpack_entry		*hte;
 	long				 dynidx = HPACK_STATIC_SIZE;
 
-	if (index < 1 || index > dynidx + (long)hpack->htb_dynamic_size)
+	if (index < 1 || index > dynidx + hpack->htb_dynamic_entries)
 		return (NULL);
 
 	if (index <= dynidx) {
@@ -181,20 +262,21 @@ hpack_table_getbyid(long index, struct hpack_index *idbuf,
 		if (id->hpi_id != index)
 			errx(1, "corrupted HPACK static table %ld != %ld",
 			    id->hpi_id, index);
+		memcpy(idbuf, id, sizeof(*id));
+		idbuf->hpi_namelen = static_lengths[index - 1].hsl_namelen;
+		idbuf->hpi_valuelen = static_lengths[index - 1].hsl_valuelen;
+		idbuf->hpi_entry = NULL;
 	} else {
 		/* Dynamic table */
-		TAILQ_FOREACH_REVERSE(hdr, hpack->htb_dynamic,
-		    hpack_headerblock, hdr_entry) {
-			dynidx++;
-			if (dynidx == index) {
-				idbuf->hpi_id = index;
-				idbuf->hpi_name = hdr->hdr_name;
-				idbuf->hpi_value = hdr->hdr_value;
-				id = idbuf;
-				break;
-			}
-		}
+		hte = hpack_table_entry(index - dynidx - 1, hpack);
+		idbuf->hpi_id = index;
+		idbuf->hpi_name = hte->hte_name;
+		idbuf->hpi_value = hte->hte_value;
+		idbuf->hpi_namelen = hte->hte_namelen;
+		idbuf->hpi_valuelen = hte->hte_valuelen;
+		idbuf->hpi_entry = hte;
 	}
+	id = idbuf;
 
 	return (id);
 }
@@ -203,62 +285,164 @@ static const struct hpack_index *
 hpack_table_getbyheader(struct hpack_header *key, struct hpack_index *idbuf,
     struct hpack_table *hpack)
 {
-	struct hpack_index		*id = NULL, *firstid = NULL;
-	struct hpack_header		*hdr;
-	size_t				 i, dynidx = HPACK_STATIC_SIZE;
+	const struct hpack_index	*id;
+	struct hpack_entry		*hte;
+	struct hpack_bucket		*bucket;
+	unsigned int			 hash;
+	size_t				 mask;
 
 	if (key->hdr_name == NULL)
 		return (NULL);
 
 	/*
 	 * Search the static and dynamic tables for a perfect match
-	 * or the first match that only matches the name.
+	 * or the first match that only matches the name.  Names are
+	 * case-insensitive but the values have to match exactly.
 	 */
 
 	/* Static table */
-	for (i = 0; i < dynidx; i++) {
-		id = &static_table[i];
-		if (strcasecmp(id->hpi_name, key->hdr_name) != 0)
-			continue;
-		if (firstid == NULL) {
-			memcpy(idbuf, id, sizeof(*id));
-			idbuf->hpi_value = NULL;
-			firstid = idbuf;
+	if ((id = hpack_table_getstatic(key, idbuf)) != NULL &&
+	    id->hpi_value != NULL)
+		return (id);
+	if (hpack->htb_dynamic_entries == 0)
+		return (id);
+	mask = hpack->htb_dynamic_slots - 1;
+
+	/* Dynamic table, the newest entry is first in each bucket */
+	if (key->hdr_value != NULL) {
+		hash = hpack_table_hash(key->hdr_name, key->hdr_namelen,
+		    key->hdr_value, key->hdr_valuelen);
+		bucket = &hpack->htb_fields[hash & mask];
+		LIST_FOREACH(hte, bucket, hte_field_entry) {
+			if (hte->hte_fieldhash != hash ||
+			    hte->hte_namelen != key->hdr_namelen ||
+			    hte->hte_valuelen != key->hdr_valuelen ||
+			    strncasecmp(hte->hte_name,
+			    key->hdr_name, key->hdr_namelen) != 0 ||
+			    memcmp(hte->hte_value,
+			    key->hdr_value, key->hdr_valuelen) != 0)
+				continue;
+			idbuf->hpi_value = hte->hte_value;
+			goto found;
 		}
-		if ((id->hpi_value != NULL && key->hdr_value != NULL) &&
-		    strcasecmp(id->hpi_value, key->hdr_value) == 0)
-			return (id);
 	}
-
-	/* Dynamic table */
-	TAILQ_FOREACH_REVERSE(hdr, hpack->htb_dynamic,
-	    hpack_headerblock, hdr_entry) {
-		dynidx++;
-		if (strcasecmp(hdr->hdr_name, key->hdr_name) != 0)
+	if (id != NULL)
+		return (id);
+
+	hash = hpack_table_hash(key->hdr_name, key->hdr_namelen, NULL, 0);
+	bucket = &hpack->htb_names[hash & mask];
+	LIST_FOREACH(hte, bucket, hte_name_entry) {
+		if (hte->hte_namehash != hash ||
+		    hte->hte_namelen != key->hdr_namelen ||
+		    strncasecmp(hte->hte_name,
+		    key->hdr_name, key->hdr_namelen) != 0)
 			continue;
-		if (firstid == NULL) {
-			idbuf->hpi_id = dynidx;
-			idbuf->hpi_name = hdr->hdr_name;
-			idbuf->hpi_value = NULL;
-			firstid = idbuf;
-		}
-		if ((hdr->hdr_value != NULL && key->hdr_value != NULL) &&
-		    strcasecmp(hdr->hdr_value, key->hdr_value) == 0) {
-			idbuf->hpi_id = dynidx;
-			idbuf->hpi_name = hdr->hdr_name;
-			idbuf->hpi_value = hdr->hdr_value;
-			id = idbuf;
-			return (id);
+		idbuf->hpi_value = NULL;
+		goto found;
+	}
+
+	return (NULL);
+ found:
+	idbuf->hpi_id = HPACK_STATIC_SIZE + 1 +
+	    (long)(hpack->htb_dynamic_seq - 1 - hte->hte_seq);
+	idbuf->hpi_name = hte->hte_name;
+	return (idbuf);
+}
+
+static const struct hpack_index *
+hpack_table_getstatic(struct hpack_header *key, struct hpack_index *idbuf)
+{
+	const struct hpack_static_name	*hsn;
+	struct hpack_index		*id;
+	size_t				 i, vlen;
+
+	if ((hsn = hpack_table_getname(key->hdr_name,
+	    key->hdr_namelen)) == NULL)
+		return (NULL);
+	id = &static_table[hsn->hsn_id - 1];
+
+	/* The entries with the same name follow each other */
+	if (key->hdr_value != NULL) {
+		vlen = key->hdr_valuelen;
+		for (i = 0; i < hsn->hsn_count; i++, id++) {
+			if (static_lengths[id->hpi_id - 1].hsl_valuelen ==
+			    vlen && id->hpi_value != NULL &&
+			    memcmp(id->hpi_value, key->hdr_value, vlen) == 0)
+				return (id);
 		}
+		id = &static_table[hsn->hsn_id - 1];
 	}
 
-	return (firstid);
+	memcpy(idbuf, id, sizeof(*id));
+	idbuf->hpi_value = NULL;
+	return (idbuf);
+}
+
+static const struct hpack_static_name *
+hpack_table_getname(const char *name, size_t len)
+{
+	const struct hpack_static_name	*hsn;
+
+	/* Lookup the name in the perfect hash, all names are shorter */
+	if (len == 0 || len > UCHAR_MAX)
+		return (NULL);
+	hsn = &static_names[HPACK_STATIC_HASH(name, len)];
+	if (hsn->hsn_namelen != len ||
+	    strncasecmp(static_table[hsn->hsn_id - 1].hpi_name,
+	    name, len) != 0)
+		return (NULL);
+
+	return (hsn);
+}
+
+static enum hpack_header_token
+hpack_table_token(const char *name, size_t len)
+{
+	const struct hpack_static_name	*hsn;
+
+	if ((hsn = hpack_table_getname(name, len)) == NULL)
+		return (HPACK_TOKEN_NONE);
+	return (hsn->hsn_id);
+}
+
+static unsigned int
+hpack_table_hash(const char *name, size_t namelen, const char *value,
+    size_t valuelen)
+{
+	unsigned int	 hash = 2166136261U;
+	size_t		 i;
+
+	/* FNV-1a of the lowercase name and optionally the exact value */
+	for (i = 0; i < namelen; i++)
+		hash = (hash ^ (unsigned char)tolower((unsigned char)name[i])) *
+		    16777619U;
+	if (value == NULL)
+		return (hash);
+	hash = (hash ^ ':') * 16777619U;
+	for (i = 0; i < valuelen; i++)
+		hash = (hash ^ (unsigned char)value[i]) * 16777619U;
+
+	return (hash);
+}
+
+static void
+hpack_table_link(struct hpack_entry *hte, struct hpack_table *hpack)
+{
+	size_t		 mask = hpack->htb_dynamic_slots - 1;
+
+	LIST_INSERT_HEAD(&hpack->htb_names[hte->hte_namehash & mask],
+	    hte, hte_name_entry);
+	LIST_INSERT_HEAD(&hpack->htb_fields[hte->hte_fieldhash & mask],
+	    hte, hte_field_entry);
 }
 
 static int
 hpack_table_add(struct hpack_header *hdr, struct hpack_table *hpack)
 {
-	long		 newsize;
+	struct hpack_entry	*hte;
+	char			*name, *value;
+	long			 newsize;
+	size_t			 slot;
 
 	if (hdr->hdr_index != HPACK_INDEX)
 		return (0);
@@ -268,7 +452,7 @@ hpack_table_add(struct hpack_header *hdr, struct hpack_table *hpack)
 	 * the additional 32 octets account for an estimated overhead
 	 * associated with an entry.
 	 */
-	newsize = strlen(hdr->hdr_name) + strlen(hdr->hdr_value) + 32;
+	newsize = hdr->hdr_namelen + hdr->hdr_valuelen + 32;
 
 	if (newsize > hpack->htb_table_size) {
 		/*
@@ -277,37 +461,99 @@ hpack_table_add(struct hpack_header *hdr, struct hpack_table *hpack)
 		 */
 		hpack_table_evict(0, newsize, hpack);
 		return (0);
-	} else
-		hpack_table_evict(hpack->htb_table_size,
-		    newsize, hpack);
+	}
+
+	if (hpack->htb_dynamic == NULL && hpack_table_alloc(hpack) == -1)
+		return (-1);
 
-	if (hpack_header_add(hpack->htb_dynamic,
-	    hdr->hdr_name, hdr->hdr_value, hdr->hdr_index) == NULL)
+	/* Take the shared strings of a decoded header or copy them */
+	if (hdr->hdr_flags & HPACK_HEADER_F_NAME_SHARED)
+		name = hpack_string_ref(hdr->hdr_name);
+	else if ((name = hpack_string_new(hdr->hdr_name,
+	    hdr->hdr_namelen)) == NULL)
+		return (-1);
+	if (hdr->hdr_flags & HPACK_HEADER_F_VALUE_SHARED)
+		value = hpack_string_ref(hdr->hdr_value);
+	else if ((value = hpack_string_new(hdr->hdr_value,
+	    hdr->hdr_valuelen)) == NULL) {
+		hpack_string_free(name);
 		return (-1);
+	}
+
+	hpack_table_evict(hpack->htb_table_size, newsize, hpack);
+
+	/* Append the new entry to the head of the ring */
+	slot = hpack->htb_dynamic_first + hpack->htb_dynamic_entries;
+	hte = &hpack->htb_dynamic[slot & (hpack->htb_dynamic_slots - 1)];
+	hte->hte_name = name;
+	hte->hte_value = value;
+	hte->hte_namelen = hdr->hdr_namelen;
+	hte->hte_valuelen = hdr->hdr_valuelen;
+	hte->hte_seq = hpack->htb_dynamic_seq++;
+	hte->hte_namehash = hpack_table_hash(hdr->hdr_name,
+	    hdr->hdr_namelen, NULL, 0);
+	hte->hte_fieldhash = hpack_table_hash(hdr->hdr_name,
+	    hdr->hdr_namelen, hdr->hdr_value, hdr->hdr_valuelen);
+	hte->hte_token = hdr->hdr_token;
+	hte->hte_namecls = hpack->htb_namecls;
+	hte->hte_valuecls = hpack->htb_valuecls;
+	hpack_table_link(hte, hpack);
 	hpack->htb_dynamic_entries++;
 	hpack->htb_dynamic_size += newsize;
 
 	return (0);
 }
 
+static int
+hpack_table_alloc(struct hpack_table *hpack)
+{
+	struct hpack_bucket	*buckets;
+	size_t			 slots, i;
+
+	slots = HPACK_TABLE_SLOTS;
+	while (slots < (size_t)hpack->htb_max_table_size / 32)
+		slots *= 2;
+
+	/* Allocate the entries and hash buckets at once */
+	if ((hpack->htb_dynamic = reallocarray(NULL, slots,
+	    sizeof(struct hpack_entry) +
+	    sizeof(struct hpack_bucket) * 2)) == NULL)
+		return (-1);
+
+	buckets = (struct hpack_bucket *)(hpack->htb_dynamic + slots);
+	hpack->htb_names = buckets;
+	hpack->htb_fields = buckets + slots;
+	for (i = 0; i < slots; i++) {
+		LIST_INIT(&hpack->htb_names[i]);
+		LIST_INIT(&hpack->htb_fields[i]);
+	}
+	hpack->htb_dynamic_slots = slots;
+	hpack->htb_dynamic_first = 0;
+
+	return (0);
+}
+
 static int
 hpack_table_evict(long size, long newsize, struct hpack_table *hpack)
 {
-	struct hpack_header	*hdr;
+	struct hpack_entry	*hte;
 
+	/* Remove the oldest entries from the tail of the ring */
 	while (size < (hpack->htb_dynamic_size + newsize) &&
-	    (hdr = TAILQ_FIRST(hpack->htb_dynamic)) != NULL) {
-		TAILQ_REMOVE(hpack->htb_dynamic, hdr, hdr_entry);
+	    hpack->htb_dynamic_entries > 0) {
+		hte = &hpack->htb_dynamic[hpack->htb_dynamic_first];
+		hpack->htb_dynamic_first = (hpack->htb_dynamic_first + 1) &
+		    (hpack->htb_dynamic_slots - 1);
 		hpack->htb_dynamic_entries--;
 		hpack->htb_dynamic_size -=
-		    strlen(hdr->hdr_name) +
-		    strlen(hdr->hdr_value) +
-		    32;
-		hpack_header_free(hdr);
+		    hte->hte_namelen + hte->hte_valuelen + 32;
+		LIST_REMOVE(hte, hte_name_entry);
+		LIST_REMOVE(hte, hte_field_entry);
+		hpack_string_free(hte->hte_name);
+		hpack_string_free(hte->hte_value);
 	}
 
-	if (TAILQ_EMPTY(hpack->htb_dynamic) &&
-	    hpack->htb_dynamic_entries != 0 &&
+	if (hpack->htb_dynamic_entries == 0 &&
 	    hpack->htb_dynamic_size != 0)
 		errx(1, "corrupted HPACK dynamic table");
 
@@ -333,388 +579,1292 @@ hpack_table_size(struct hpack_table *hpack)
 	return ((size_t)hpack->htb_dynamic_size);
 }
 
-struct hpack_headerblock *
-hpack_decode(unsigned char *data, size_t len, struct hpack_table *hpack)
+void
+hpack_table_setflags(struct hpack_table *hpack, unsigned int flags)
 {
-	struct hpack_headerblock	*hdrs = NULL;
-	struct hbuf			*hbuf = NULL;
-	struct hpack_table		*ctx = NULL;
-	int				 ret = -1;
+	hpack->htb_flags = flags;
+}
 
-	if (len == 0 || len > LONG_MAX)
-		goto fail;
+void
+hpack_table_setmaxlistsize(struct hpack_table *hpack, size_t size)
+{
+	hpack->htb_max_list_size = size;
+}
 
-	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
-		goto fail;
-	if ((hdrs = hpack_headerblock_new()) == NULL)
-		goto fail;
+void
+hpack_table_setarena(struct hpack_table *hpack, struct hpack_arena *arena)
+{
+	hpack->htb_hdrarena = arena;
+}
 
-	hpack->htb_headers = hdrs;
-	hpack->htb_next = NULL;
+static char *
+hpack_string_new(const char *data, size_t len)
+{
+	struct hpack_string	*hs;
 
-	if ((hbuf = hbuf_new(data, len)) == NULL)
-		goto fail;
+	if (len > SIZE_MAX - sizeof(*hs) ||
+	    (hs = malloc(sizeof(*hs) + len)) == NULL)
+		return (NULL);
+	hs->hs_refs = 1;
+	if (data != NULL)
+		memcpy(hs->hs_data, data, len);
+	hs->hs_data[len] = '\0';
 
-	do {
-		if (hpack_decode_buf(hbuf, hpack) == -1)
-			goto fail;
-	} while (hbuf_left(hbuf) > 0);
+	return (hs->hs_data);
+}
 
-	ret = 0;
- fail:
-	hbuf_free(hbuf);
-	if (ret != 0) {
-		hpack_headerblock_free(hdrs);
-		hdrs = NULL;
-	} else
-		hdrs = hpack->htb_headers;
-	hpack->htb_headers = NULL;
-	hpack->htb_next = NULL;
+struct hpack_arena *
+hpack_arena_new(size_t size)
+{
+	struct hpack_arena	*arena;
 
-	/* Free the local table (for single invocations) */
-	hpack_table_free(ctx);
+	if ((arena = calloc(1, sizeof(*arena))) == NULL)
+		return (NULL);
+	SLIST_INIT(&arena->har_chunks);
+	arena->har_size = MAX(size, HPACK_ARENA_CHUNKSZ);
 
-	return (hdrs);
+	return (arena);
 }
 
-static long
-hpack_decode_int(struct hbuf *buf, unsigned char prefix)
+void
+hpack_arena_reset(struct hpack_arena *arena)
 {
-	unsigned long	 i = 0;
-	unsigned char	 b = 0, m;
+	struct hpack_chunk	*hch;
+	size_t			 size = 0;
 
-	if (hbuf_left(buf) == 0)
-		return (-1);
+	if (arena == NULL)
+		return;
 
-	if (hbuf_readchar(buf, &b) == -1 ||
-	    hbuf_advance(buf, 1) == -1)
-		return (-1);
+	hch = SLIST_FIRST(&arena->har_chunks);
+	if (hch != NULL && SLIST_NEXT(hch, hch_entry) == NULL) {
+		hch->hch_used = 0;
+		return;
+	}
 
-	/* Mask and remainder after the prefix of the first octet */
-	m = ~prefix;
-	i = b & m;
+	/* Fit the next block into a single chunk */
+	while ((hch = SLIST_FIRST(&arena->har_chunks)) != NULL) {
+		SLIST_REMOVE_HEAD(&arena->har_chunks, hch_entry);
+		size += hch->hch_size;
+		free(hch);
+	}
+	arena->har_size = MAX(arena->har_size, size);
+}
 
-	if (i >= m) {
-		m = 0;
+void
+hpack_arena_free(struct hpack_arena *arena)
+{
+	struct hpack_chunk	*hch;
 
-		/* Read varint bits while the 0x80 bit is set */
-		do {
-			if (i > LONG_MAX)
-				return (-1);
-			if (hbuf_readchar(buf, &b) == -1 ||
-			    hbuf_advance(buf, 1) == -1)
-				return (-1);
-			i += (b & ~0x80) << m;
-			m += 7;
-		} while (b & 0x80);
+	if (arena == NULL)
+		return;
+	while ((hch = SLIST_FIRST(&arena->har_chunks)) != NULL) {
+		SLIST_REMOVE_HEAD(&arena->har_chunks, hch_entry);
+		free(hch);
 	}
-
-	return ((long)i);
+	free(arena);
 }
 
-static long
-hpack_decode_index(struct hbuf *buf, unsigned char prefix,
-    const struct hpack_index **idptr, struct hpack_table *hpack)
+static void *
+hpack_arena_alloc(struct hpack_arena *arena, size_t len)
 {
-	struct hpack_index		 idbuf;
-	struct hpack_header		*hdr = hpack->htb_next;
-	const struct hpack_index	*id;
-	long				 i;
-	int				 hasvalue;
-
-	if (idptr != NULL)
-		*idptr = NULL;
+	struct hpack_chunk	*hch;
+	size_t			 size;
+	void			*ptr;
 
-	if ((i = hpack_decode_int(buf, prefix)) == -1)
-		return (-1);
-	DPRINTF("%s: index %ld", __func__, i);
+	if (len > SIZE_MAX - HPACK_ARENA_ALIGN - sizeof(*hch))
+		return (NULL);
+	len = (len + HPACK_ARENA_ALIGN - 1) & ~(HPACK_ARENA_ALIGN - 1);
 
-	if (i == 0)
-		return (0);
-	if ((id = hpack_table_getbyid(i, &idbuf, hpack)) == NULL) {
-		DPRINTF("index not found: %ld\n", i);
-		return (-1);
+	hch = SLIST_FIRST(&arena->har_chunks);
+	if (hch == NULL || hch->hch_size - hch->hch_used < len) {
+		size = MAX(arena->har_size, len);
+		if ((hch = malloc(sizeof(*hch) + size)) == NULL)
+			return (NULL);
+		hch->hch_size = size;
+		hch->hch_used = 0;
+		SLIST_INSERT_HEAD(&arena->har_chunks, hch, hch_entry);
 	}
 
-	if (hdr == NULL || hdr->hdr_name != NULL || hdr->hdr_value != NULL)
-		errx(1, "invalid header");
+	ptr = hch->hch_data + hch->hch_used;
+	hch->hch_used += len;
 
-	if ((hdr->hdr_name = strdup(id->hpi_name)) == NULL)
-		return (-1);
-	hasvalue = id->hpi_value == NULL ? 0 : 1;
-	if (hasvalue &&
-	    (hdr->hdr_value = strdup(id->hpi_value)) == NULL) {
-		free(hdr->hdr_name);
-		hdr->hdr_name = NULL;
-		return (-1);
-	}
+	return (ptr);
+}
 
-	DPRINTF("%s: index: %ld (%s%s%s)", __func__,
-	    i, id->hpi_name,
-	    hasvalue ? ": " : "",
-	    hasvalue ? id->hpi_value : "");
+static void *
+hpack_arena_pos(struct hpack_arena *arena)
+{
+	struct hpack_chunk	*hch = SLIST_FIRST(&arena->har_chunks);
 
-	if (idptr != NULL)
-		*idptr = id;
+	/* The position of the next allocation in the current chunk */
+	if (hch == NULL)
+		return (NULL);
+	return (hch->hch_data + hch->hch_used);
+}
 
-	return (i);
+static void
+hpack_arena_trim(struct hpack_arena *arena, void *ptr, size_t len)
+{
+	struct hpack_chunk	*hch;
+	unsigned char		*p = ptr;
+
+	/* Release the chunks that were allocated after the position */
+	while ((hch = SLIST_FIRST(&arena->har_chunks)) != NULL &&
+	    (p < hch->hch_data || p > hch->hch_data + hch->hch_size)) {
+		SLIST_REMOVE_HEAD(&arena->har_chunks, hch_entry);
+		free(hch);
+	}
+	if (hch == NULL)
+		return;
+
+	/* Shrink the last allocation or rewind to the position */
+	len = (len + HPACK_ARENA_ALIGN - 1) & ~(HPACK_ARENA_ALIGN - 1);
+	hch->hch_used = (size_t)(p - hch->hch_data) + len;
 }
 
 static char *
-hpack_decode_str(struct hbuf *buf, unsigned char prefix)
+hpack_arena_strdup(struct hpack_arena *arena, const char *data, size_t len)
 {
-	long		 i;
-	unsigned char	*ptr, c;
-	char		*str;
+	char	*str;
 
-	if (hbuf_readchar(buf, &c) == -1)
+	if ((str = hpack_arena_alloc(arena, len + 1)) == NULL)
 		return (NULL);
-	if ((i = hpack_decode_int(buf, prefix)) == -1)
-		return (NULL);
-	if (hbuf_readbuf(buf, &ptr, (size_t)i) == -1 ||
-	    hbuf_advance(buf, (size_t)i) == -1)
-		return (NULL);
-	if ((c & HPACK_M_LITERAL) == HPACK_F_LITERAL_HUFFMAN) {
-		DPRINTF("%s: decoding huffman code (size %ld)", __func__, i);
-		if ((str = hpack_huffman_decode_str(ptr, (size_t)i)) == NULL)
-			return (NULL);
-	} else {
-		if ((str = calloc(1, (size_t)i + 1)) == NULL)
-			return (NULL);
-		memcpy(str, ptr, (size_t)i);
-	}
+	memcpy(str, data, len);
+	str[len] = '\0';
+
 	return (str);
 }
 
-static int
-hpack_decode_literal(struct hbuf *buf, unsigned char prefix,
-    struct hpack_table *hpack)
+static char *
+hpack_string_ref(const char *str)
 {
-	struct hpack_header		*hdr = hpack->htb_next;
-	const struct hpack_index	*id;
-	long				 i;
-	char				*str;
-
-	if ((i = hpack_decode_index(buf, prefix, &id, hpack)) == -1)
-		return (-1);
+	struct hpack_string	*hs;
 
-	if (i == 0) {
-		if (hdr == NULL ||
-		    hdr->hdr_name != NULL || hdr->hdr_value != NULL)
-			errx(1, "invalid header");
-
-		if ((str = hpack_decode_str(buf,
-		    HPACK_M_LITERAL)) == NULL)
-			return (-1);
-		DPRINTF("%s: name: %s", __func__, str);
-		hdr->hdr_name = str;
-	}
+	hs = HPACK_UNCONST(str - offsetof(struct hpack_string, hs_data));
+	hs->hs_refs++;
 
-	/* The index might have set a default value */
-	if (hdr->hdr_value != NULL) {
-		free(hdr->hdr_value);
-		hdr->hdr_value = NULL;
-	}
+	return (hs->hs_data);
+}
 
-	if ((str = hpack_decode_str(buf, HPACK_M_LITERAL)) == NULL)
-		return (-1);
-	DPRINTF("%s: value: %s", __func__, str);
-	hdr->hdr_value = str;
+static void
+hpack_string_free(const char *str)
+{
+	struct hpack_string	*hs;
 
-	return (0);
+	if (str == NULL)
+		return;
+	hs = HPACK_UNCONST(str - offsetof(struct hpack_string, hs_data));
+	if (--hs->hs_refs == 0)
+		free(hs);
 }
 
-static int
-hpack_decode_buf(struct hbuf *buf, struct hpack_table *hpack)
+struct hpack_headerblock *
+hpack_decode(unsigned char *data, size_t len, struct hpack_table *hpack)
 {
-	struct hpack_header	*hdr = NULL;
-	unsigned char		 c;
-	long			 i;
+	struct hpack_headerblock	*hdrs = NULL;
+	struct hpack_table		*ctx = NULL;
 
-	if (hbuf_readchar(buf, &c) == -1)
-		goto fail;
+	if (len == 0 || len > LONG_MAX)
+		return (NULL);
 
-	if ((hdr = hpack_header_new()) == NULL)
-		goto fail;
-	hdr->hdr_index = HPACK_NO_INDEX;
-	hpack->htb_next = hdr;
+	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
+		return (NULL);
+	if (hpack->htb_hdrarena != NULL) {
+		if ((hdrs = hpack_arena_alloc(hpack->htb_hdrarena,
+		    sizeof(*hdrs))) == NULL)
+			goto done;
+		TAILQ_INIT(hdrs);
+	} else if ((hdrs = hpack_headerblock_new()) == NULL)
+		goto done;
 
-	/* 6.1 Indexed Header Field Representation */
-	if ((c & HPACK_M_INDEX) == HPACK_F_INDEX) {
-		DPRINTF("%s: 0x%02x: 6.1 index", __func__, c);
+	hpack->htb_headers = hdrs;
+	if (hpack_decode_block(data, len, hpack) == -1) {
+		/* Headers in the arena are released with the arena */
+		if (hpack->htb_hdrarena == NULL)
+			hpack_headerblock_free(hdrs);
+		hdrs = NULL;
+	}
+	hpack->htb_headers = NULL;
 
-		/* 7 bit index */
-		if ((i = hpack_decode_index(buf,
-		    HPACK_M_INDEX, NULL, hpack)) == -1)
-			goto fail;
+ done:
+	/* Free the local table (for single invocations) */
+	hpack_table_free(ctx);
 
-		/* No value means header with empty value */
-		if ((hdr->hdr_value == NULL) &&
-		    (hdr->hdr_value = strdup("")) == NULL)
-			goto fail;
+	return (hdrs);
+}
+
+int
+hpack_decode_cb(unsigned char *data, size_t len, struct hpack_table *hpack,
+    int (*cb)(struct hpack_header *, void *), void *arg)
+{
+	struct hpack_table	*ctx = NULL;
+	int			 ret;
+
+	if (len == 0 || len > LONG_MAX || cb == NULL)
+		return (-1);
+
+	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
+		return (-1);
+
+	hpack->htb_cb = cb;
+	hpack->htb_cbarg = arg;
+	ret = hpack_decode_block(data, len, hpack);
+	hpack->htb_cb = NULL;
+	hpack->htb_cbarg = NULL;
+
+	/* Free the local table (for single invocations) */
+	hpack_table_free(ctx);
+
+	return (ret);
+}
+
+static int
+hpack_decode_block(unsigned char *data, size_t len, struct hpack_table *hpack)
+{
+	struct hbuf	 buf;
+	int		 ret = 0;
+
+	/* Read the input in place, decoded strings are copied or views */
+	hbuf_view(&buf, data, len);
+	hpack->htb_next = NULL;
+
+	do {
+		if (hpack_decode_buf(&buf, hpack) == -1) {
+			ret = -1;
+			break;
+		}
+	} while (hbuf_left(&buf) > 0);
+
+	return (hpack_decode_end(hpack, ret));
+}
+
+static int
+hpack_decode_end(struct hpack_table *hpack, int ret)
+{
+	int	 full = hpack->htb_list_full, error = hpack->htb_error;
+
+	hpack->htb_next = NULL;
+	hpack->htb_list_size = 0;
+	hpack->htb_list_full = 0;
+	hpack->htb_error = 0;
+	hpack->htb_regular = 0;
+
+	/* A decoding error is not masked by a dropped or invalid list */
+	if (ret == -1)
+		return (-1);
+	if (error) {
+		DPRINTF("%s: invalid header list", __func__);
+		errno = error;
+		return (-1);
+	}
+	if (full) {
+		DPRINTF("%s: header list too large", __func__);
+		errno = EMSGSIZE;
+		return (-1);
 	}
 
-	/* 6.2.1. Literal Header Field with Incremental Indexing */
-	else if ((c & HPACK_M_LITERAL_INDEX) == HPACK_F_LITERAL_INDEX) {
-		DPRINTF("%s: 0x%02x: 6.2.1 literal indexed", __func__, c);
+	return (0);
+}
+
+int
+hpack_decode_fragment(unsigned char *data, size_t len, int last,
+    struct hpack_table *hpack, int (*cb)(struct hpack_header *, void *),
+    void *arg)
+{
+	struct hbuf	 view;
+	size_t		 pos, need;
+	int		 scan, more, ret = -1;
+
+	if (hpack == NULL || cb == NULL || len > LONG_MAX)
+		return (-1);
+
+	hpack->htb_cb = cb;
+	hpack->htb_cbarg = arg;
+	hpack->htb_next = NULL;
+
+	/* First complete a field that was split by the previous fragment */
+	if (hpack_decode_pending(&data, &len, hpack) == -1)
+		goto fail;
 
-		/* 6 bit index */
-		if (hpack_decode_literal(buf,
-		    HPACK_M_LITERAL_INDEX, hpack) == -1)
+	hbuf_view(&view, data, len);
+	while (hbuf_left(&view) > 0) {
+		pos = view.rpos;
+		if ((scan = hpack_decode_scan(&view, 0, &need, &more,
+		    hpack)) == -1)
 			goto fail;
-		hdr->hdr_index = HPACK_INDEX;
+		view.rpos = pos;
+		view.eof = 0;
+
+		/* Decode complete fields in place */
+		if (scan == HPACK_S_COMPLETE) {
+			if (hpack_decode_buf(&view, hpack) == -1)
+				goto fail;
+			continue;
+		}
+
+		if (scan == HPACK_S_DROP) {
+			/* Skip the strings of a field that will be dropped */
+			if (hpack_decode_drop(&view, pos, need, more,
+			    hpack) == -1)
+				goto fail;
+		} else {
+			/* Keep the incomplete field for the next fragment */
+			if ((hpack->htb_pending =
+			    hbuf_new(data + pos, len - pos)) == NULL)
+				goto fail;
+			hpack->htb_pending_need = need - pos;
+		}
+		break;
+	}
+
+	/* A truncated block is a decoding error, even if the list is full */
+	if (last && (hpack->htb_pending != NULL || hpack->htb_skip != 0 ||
+	    hpack->htb_skipvalue))
+		goto fail;
+
+	ret = 0;
+ fail:
+	if (ret != 0) {
+		hbuf_free(hpack->htb_pending);
+		hpack->htb_pending = NULL;
+		hpack->htb_skip = 0;
+		hpack->htb_skipvalue = 0;
+	}
+	if (ret != 0 || last)
+		ret = hpack_decode_end(hpack, ret);
+	hpack->htb_cb = NULL;
+	hpack->htb_cbarg = NULL;
+	hpack->htb_next = NULL;
+
+	return (ret);
+}
+
+static int
+hpack_decode_pending(unsigned char **data, size_t *len,
+    struct hpack_table *hpack)
+{
+	struct hbuf	*buf;
+	size_t		 n, need;
+	int		 scan, more, ret;
+	unsigned int	 flags;
+
+	for (;;) {
+		/* Discard the strings of a dropped field */
+		n = MIN(hpack->htb_skip, *len);
+		*data += n;
+		*len -= n;
+		hpack->htb_skip -= n;
+		if (hpack->htb_skip != 0 || *len == 0)
+			return (0);
+
+		if ((buf = hpack->htb_pending) == NULL) {
+			if (!hpack->htb_skipvalue)
+				return (0);
+
+			/* The value of a dropped field follows its name */
+			if ((buf = hpack->htb_pending =
+			    hbuf_new(NULL, 0)) == NULL)
+				return (-1);
+			hpack->htb_pending_need = 1;
+		}
+
+		/*
+		 * Append the bytes that are needed to find the end of the
+		 * field, which never reads beyond it, and scan it again.
+		 */
+		n = MIN(*len, hpack->htb_pending_need - buf->wpos);
+		if (hbuf_writebuf(buf, *data, n) == -1)
+			return (-1);
+		*data += n;
+		*len -= n;
+		if (buf->wpos < hpack->htb_pending_need)
+			return (0);
+
+		buf->rpos = buf->eof = 0;
+		if ((scan = hpack_decode_scan(buf, hpack->htb_skipvalue,
+		    &need, &more, hpack)) == -1)
+			return (-1);
+		buf->rpos = buf->eof = 0;
+
+		if (scan == HPACK_S_PARTIAL) {
+			hpack->htb_pending_need = need;
+			continue;
+		}
+
+		/* Decode the field once it is complete */
+		hpack->htb_pending = NULL;
+		if (scan == HPACK_S_COMPLETE) {
+			/* Copy the strings, the buffer is freed afterwards */
+			flags = hpack->htb_flags;
+			hpack->htb_flags &= ~HPACK_TABLE_F_VIEW;
+			ret = hpack_decode_buf(buf, hpack);
+			hpack->htb_flags = flags;
+		} else
+			ret = hpack_decode_drop(buf, 0, need, more, hpack);
+		hbuf_free(buf);
+		if (ret == -1)
+			return (-1);
+	}
+}
+
+static int
+hpack_decode_scan(struct hbuf *buf, int value, size_t *need, int *more,
+    struct hpack_table *hpack)
+{
+	const struct hpack_octet	*ho = NULL;
+	unsigned char			 c;
+	long				 i;
+	size_t				 len, minlen = 0;
+	int				 strings = 1, drop = 0;
+
+	/*
+	 * Find the end of the field without decoding its strings.  The
+	 * end of a partial field is the number of bytes that are needed
+	 * to continue scanning.  A field that will be dropped anyway and
+	 * is incomplete ends with the string that is available, so its
+	 * remaining strings can be skipped instead of buffered.
+	 */
+	*more = 0;
+	if (!value) {
+		if (hbuf_readchar(buf, &c) == -1)
+			goto partial;
+		ho = &hpack_octets[c];
+		if ((i = hpack_decode_int(buf, ho->ho_mask)) == -1)
+			goto partial;
+		if (ho->ho_type != HPACK_T_LITERAL) {
+			*need = buf->rpos;
+			return (HPACK_S_COMPLETE);
+		}
+
+		/* Literals with a new name have two strings */
+		strings = i == 0 ? 2 : 1;
+	}
+
+	for (; strings > 0; strings--) {
+		if (hbuf_readchar(buf, &c) == -1 ||
+		    (i = hpack_decode_int(buf, HPACK_M_LITERAL)) == -1) {
+			if (drop && buf->eof) {
+				/* Skip the name, the value follows later */
+				*need = buf->rpos;
+				*more = 1;
+				return (HPACK_S_DROP);
+			}
+			goto partial;
+		}
+		len = (size_t)i;
+
+		/* Huffman codes have up to 30 bits per character */
+		if ((c & HPACK_M_LITERAL) == HPACK_F_LITERAL_HUFFMAN)
+			minlen += len / 30 * 8;
+		else
+			minlen += len;
+		*need = buf->rpos + len;
+
+		if (value || (hpack->htb_max_list_size != 0 &&
+		    (hpack->htb_list_full || minlen + 32 >
+		    hpack->htb_max_list_size - hpack->htb_list_size) &&
+		    (ho->ho_index != HPACK_INDEX ||
+		    minlen + 32 > (size_t)hpack->htb_table_size)))
+			drop = 1;
+		if (hbuf_advance(buf, len) == -1) {
+			if (drop) {
+				*more = strings > 1;
+				return (HPACK_S_DROP);
+			}
+
+			/* Wait for the string and the next string length */
+			*need += strings > 1;
+			return (HPACK_S_PARTIAL);
+		}
+	}
+
+	/* The value of a dropped field is never decoded */
+	*need = buf->rpos;
+	return (value ? HPACK_S_DROP : HPACK_S_COMPLETE);
+ partial:
+	if (!buf->eof)
+		return (-1);
+	*need = buf->wpos + 1;
+	return (HPACK_S_PARTIAL);
+}
+
+static int
+hpack_decode_drop(struct hbuf *buf, size_t pos, size_t need, int more,
+    struct hpack_table *hpack)
+{
+	/* The entry is larger than the table and empties it */
+	if (!hpack->htb_skipvalue &&
+	    hpack_octets[buf->data[pos]].ho_index == HPACK_INDEX)
+		hpack_table_evict(0, 0, hpack);
+	hpack->htb_list_full = 1;
+
+	/* Keep the start of a value that follows the skipped name */
+	if (need < buf->wpos) {
+		if ((hpack->htb_pending = hbuf_new(buf->data + need,
+		    buf->wpos - need)) == NULL)
+			return (-1);
+		hpack->htb_pending_need = hpack->htb_pending->wpos + 1;
+	}
+	hpack->htb_skip = need > buf->wpos ? need - buf->wpos : 0;
+	hpack->htb_skipvalue = more;
+
+	return (0);
+}
+
+static long
+hpack_decode_int(struct hbuf *buf, unsigned char prefix)
+{
+	unsigned char	*p, *end, b, m;
+	unsigned long	 i;
+	unsigned int	 shift;
+
+	p = buf->data + buf->rpos;
+	end = buf->data + buf->wpos;
+	if (p >= end) {
+		buf->eof = 1;
+		return (-1);
+	}
+
+	/* Mask and remainder after the prefix of the first octet */
+	m = ~prefix;
+	i = *p++ & m;
+
+	if (i >= m) {
+		/* Unrolled varint bits of up to three more octets */
+		if (end - p >= 3) {
+			b = p[0];
+			i += b & 0x7f;
+			if ((b & 0x80) == 0) {
+				p += 1;
+				goto done;
+			}
+			b = p[1];
+			i += (unsigned long)(b & 0x7f) << 7;
+			if ((b & 0x80) == 0) {
+				p += 2;
+				goto done;
+			}
+			b = p[2];
+			i += (unsigned long)(b & 0x7f) << 14;
+			if ((b & 0x80) == 0) {
+				p += 3;
+				goto done;
+			}
+			p += 3;
+			shift = 21;
+		} else
+			shift = 0;
+
+		/* Read varint bits while the 0x80 bit is set */
+		do {
+			if (p >= end) {
+				buf->eof = 1;
+				return (-1);
+			}
+			if (shift > sizeof(i) * 8 - 8)
+				return (-1);
+			b = *p++;
+			i += (unsigned long)(b & 0x7f) << shift;
+			shift += 7;
+		} while (b & 0x80);
+	}
+
+ done:
+	if (i > LONG_MAX)
+		return (-1);
+	buf->rpos = (size_t)(p - buf->data);
+
+	return ((long)i);
+}
+
+static long
+hpack_decode_index(struct hbuf *buf, unsigned char prefix,
+    const struct hpack_index **idptr, struct hpack_table *hpack)
+{
+	struct hpack_index		 idbuf;
+	struct hpack_header		*hdr = hpack->htb_next;
+	const struct hpack_index	*id;
+	long				 i;
+	int				 hasvalue;
+
+	if (idptr != NULL)
+		*idptr = NULL;
+
+	if ((i = hpack_decode_int(buf, prefix)) == -1)
+		return (-1);
+	DPRINTF("%s: index %ld", __func__, i);
+
+	if (i == 0)
+		return (0);
+	if ((id = hpack_table_getbyid(i, &idbuf, hpack)) == NULL) {
+		DPRINTF("index not found: %ld\n", i);
+		return (-1);
+	}
+
+	if (hdr == NULL || hdr->hdr_name != NULL || hdr->hdr_value != NULL)
+		errx(1, "invalid header");
+
+	/* Literals only use the name, they have their own value */
+	hasvalue = id->hpi_value == NULL || idptr != NULL ? 0 : 1;
+
+	if (id->hpi_entry == NULL) {
+		/* Refer to the read-only static table */
+		hdr->hdr_name = id->hpi_name;
+		hdr->hdr_flags |= HPACK_HEADER_F_NAME_BORROWED;
+		if (hasvalue) {
+			hdr->hdr_value = id->hpi_value;
+			hdr->hdr_flags |= HPACK_HEADER_F_VALUE_BORROWED;
+		}
+	} else if (hpack->htb_hdrarena != NULL) {
+		/* Copy the dynamic strings into the arena of the block */
+		if ((hdr->hdr_name = hpack_arena_strdup(hpack->htb_hdrarena,
+		    id->hpi_name, id->hpi_namelen)) == NULL)
+			return (-1);
+		hdr->hdr_flags |= HPACK_HEADER_F_NAME_BORROWED;
+		if (hasvalue) {
+			if ((hdr->hdr_value =
+			    hpack_arena_strdup(hpack->htb_hdrarena,
+			    id->hpi_value, id->hpi_valuelen)) == NULL)
+				return (-1);
+			hdr->hdr_flags |= HPACK_HEADER_F_VALUE_BORROWED;
+		}
+	} else {
+		/* Share the strings of the dynamic table entry */
+		hdr->hdr_name = hpack_string_ref(id->hpi_entry->hte_name);
+		hdr->hdr_flags |= HPACK_HEADER_F_NAME_SHARED;
+		if (hasvalue) {
+			hdr->hdr_value =
+			    hpack_string_ref(id->hpi_entry->hte_value);
+			hdr->hdr_flags |= HPACK_HEADER_F_VALUE_SHARED;
+		}
+	}
+	hdr->hdr_namelen = id->hpi_namelen;
+	if (hasvalue)
+		hdr->hdr_valuelen = id->hpi_valuelen;
+
+	/* Dynamic entries keep the token and classes of their header */
+	if (id->hpi_entry == NULL)
+		hdr->hdr_token = static_lengths[id->hpi_id - 1].hsl_token;
+	else {
+		hdr->hdr_token = id->hpi_entry->hte_token;
+		hpack->htb_namecls = id->hpi_entry->hte_namecls;
+		if (hasvalue)
+			hpack->htb_valuecls = id->hpi_entry->hte_valuecls;
+	}
+
+	DPRINTF("%s: index: %ld (%s%s%s)", __func__,
+	    i, id->hpi_name,
+	    hasvalue ? ": " : "",
+	    hasvalue ? id->hpi_value : "");
+
+	if (idptr != NULL)
+		*idptr = id;
+
+	return (i);
+}
+
+static int
+hpack_decode_skip(unsigned char c, unsigned char *ptr, size_t size,
+    size_t *len, struct hpack_table *hpack)
+{
+	struct hpack_header	*hdr = hpack->htb_next;
+	unsigned char		*nul;
+	size_t			 minlen;
+
+	/* The shortest possible length of the string */
+	if ((c & HPACK_M_LITERAL) == HPACK_F_LITERAL_HUFFMAN)
+		minlen = size * 8 / 30;
+	else if ((nul = memchr(ptr, '\0', size)) != NULL)
+		minlen = (size_t)(nul - ptr);
+	else
+		minlen = size;
+
+	if (!hpack->htb_list_full &&
+	    hdr->hdr_namelen + minlen + 32 <=
+	    hpack->htb_max_list_size - hpack->htb_list_size)
+		return (0);
+	hpack->htb_list_full = 1;
+
+	/*
+	 * The header is dropped but it must still be added to the table.
+	 * An entry that is larger than the table only evicts all entries,
+	 * so the lower bound of its size is enough.
+	 */
+	if (hdr->hdr_index == HPACK_INDEX &&
+	    hdr->hdr_namelen + minlen + 32 <= (size_t)hpack->htb_table_size)
+		return (0);
+
+	DPRINTF("%s: skipping string (size %zu)", __func__, size);
+	*len = minlen;
+	return (1);
+}
+
+static char *
+hpack_decode_str(struct hbuf *buf, unsigned char prefix,
+    struct hpack_table *hpack, size_t *len, int *borrowed,
+    unsigned char *cls)
+{
+	long		 i;
+	unsigned char	*ptr, *nul, c;
+	char		*str;
+	size_t		 size, j;
+	ssize_t		 ret;
+	int		 validate;
+
+	*cls = 0;
+	if (hbuf_readchar(buf, &c) == -1)
+		return (NULL);
+	if ((i = hpack_decode_int(buf, prefix)) == -1)
+		return (NULL);
+	if (hbuf_readbuf(buf, &ptr, (size_t)i) == -1 ||
+	    hbuf_advance(buf, (size_t)i) == -1)
+		return (NULL);
+
+	/* Don't decode strings of a header that will be dropped */
+	if (hpack->htb_max_list_size != 0 &&
+	    hpack_decode_skip(c, ptr, (size_t)i, len, hpack))  {
+		*borrowed = 1;
+		return ((char *)ptr);
+	}
+
+	/* Decoded strings are shared with the dynamic table */
+	if ((c & HPACK_M_LITERAL) == HPACK_F_LITERAL_HUFFMAN) {
+		DPRINTF("%s: decoding huffman code (size %ld)", __func__, i);
+		if ((size_t)i > SSIZE_MAX / 8)
+			return (NULL);
+		size = (size_t)i * 8 / 5;
+		if (hpack->htb_hdrarena != NULL) {
+			if ((str = hpack_arena_alloc(hpack->htb_hdrarena,
+			    size + 1)) == NULL)
+				return (NULL);
+		} else if ((str = hpack_string_new(NULL, size)) == NULL)
+			return (NULL);
+		if ((ret = hpack_huffman_decode_class(ptr, (size_t)i,
+		    (unsigned char *)str, size, cls)) == -1 ||
+		    ((*cls & HPACK_C_NUL) &&
+		    (hpack->htb_flags & HPACK_TABLE_F_VALIDATE) == 0)) {
+			/* Only validation accepts (and reports) NUL */
+			if (hpack->htb_hdrarena == NULL)
+				hpack_string_free(str);
+			return (NULL);
+		}
+		str[ret] = '\0';
+		*len = (size_t)ret;
+
+		if (hpack->htb_hdrarena != NULL) {
+			/* Return the unused space to the arena */
+			hpack_arena_trim(hpack->htb_hdrarena, str, ret + 1);
+			*borrowed = 1;
+			return (str);
+		}
+		*borrowed = 0;
+		return (str);
+	}
+
+	validate = hpack->htb_flags & HPACK_TABLE_F_VALIDATE;
+	if (!validate && (nul = memchr(ptr, '\0', (size_t)i)) != NULL) {
+		/* The string ends with the first NUL character */
+		i = nul - ptr;
 	}
+	*len = (size_t)i;
+
+	if (hpack->htb_flags & HPACK_TABLE_F_VIEW) {
+		/* Refer to the raw string in the input buffer */
+		str = (char *)ptr;
+		*borrowed = 1;
+	} else if (hpack->htb_hdrarena != NULL) {
+		if ((str = hpack_arena_alloc(hpack->htb_hdrarena,
+		    (size_t)i + 1)) == NULL)
+			return (NULL);
+		*borrowed = 1;
+	} else {
+		if ((str = hpack_string_new(NULL, (size_t)i)) == NULL)
+			return (NULL);
+		*borrowed = 0;
+	}
+
+	if (str == (char *)ptr) {
+		/* Classify the view, a NUL is reported as invalid */
+		for (j = 0; validate && j < (size_t)i; j++)
+			*cls |= hpack_chars[ptr[j]];
+		return (str);
+	}
+
+	/* Copy the raw string and classify it in the same pass */
+	if (validate) {
+		for (j = 0; j < (size_t)i; j++) {
+			*cls |= hpack_chars[ptr[j]];
+			str[j] = (char)ptr[j];
+		}
+	} else
+		memcpy(str, ptr, (size_t)i);
+	str[i] = '\0';
+
+	return (str);
+}
+
+static void
+hpack_decode_check(struct hpack_header *hdr, struct hpack_table *hpack)
+{
+	unsigned char	 namecls = hpack->htb_namecls;
+	unsigned char	 valuecls = hpack->htb_valuecls;
+	const char	*value = hdr->hdr_value;
+	size_t		 len = hdr->hdr_valuelen;
+	int		 pseudo;
+
+	if (hpack->htb_error != 0)
+		return;
+
+	/*
+	 * Field names are lowercase, values do not start or end with
+	 * SP or HTAB, and pseudo-headers come first.
+	 */
+	pseudo = hdr->hdr_namelen > 0 && hdr->hdr_name[0] == ':';
+	if (hdr->hdr_namelen == 0 || (namecls & HPACK_C_NAME) ||
+	    ((namecls & HPACK_C_COLON) && (!pseudo ||
+	    memchr(hdr->hdr_name + 1, ':', hdr->hdr_namelen - 1) != NULL)) ||
+	    (valuecls & HPACK_C_VALUE) || (len > 0 &&
+	    (HPACK_C_ISWS(value[0]) || HPACK_C_ISWS(value[len - 1])))) {
+		DPRINTF("%s: invalid field", __func__);
+		hpack->htb_error = EILSEQ;
+	} else if (pseudo && hpack->htb_regular) {
+		DPRINTF("%s: pseudo-header after regular field", __func__);
+		hpack->htb_error = EBADMSG;
+	} else if (!pseudo)
+		hpack->htb_regular = 1;
+}
+
+static int
+hpack_decode_literal(struct hbuf *buf, unsigned char prefix,
+    struct hpack_table *hpack)
+{
+	struct hpack_header		*hdr = hpack->htb_next;
+	const struct hpack_index	*id;
+	long				 i;
+	char				*str;
+	int				 borrowed;
+
+	if ((i = hpack_decode_index(buf, prefix, &id, hpack)) == -1)
+		return (-1);
+
+	if (i == 0) {
+		if (hdr == NULL ||
+		    hdr->hdr_name != NULL || hdr->hdr_value != NULL)
+			errx(1, "invalid header");
+
+		if ((str = hpack_decode_str(buf, HPACK_M_LITERAL, hpack,
+		    &hdr->hdr_namelen, &borrowed, &hpack->htb_namecls)) == NULL)
+			return (-1);
+		DPRINTF("%s: name: %.*s", __func__,
+		    (int)hdr->hdr_namelen, str);
+		hdr->hdr_name = str;
+		hdr->hdr_flags |= borrowed ?
+		    HPACK_HEADER_F_NAME_BORROWED : HPACK_HEADER_F_NAME_SHARED;
+		hdr->hdr_token = hpack_table_token(str, hdr->hdr_namelen);
+	}
+
+	if ((str = hpack_decode_str(buf, HPACK_M_LITERAL, hpack,
+	    &hdr->hdr_valuelen, &borrowed, &hpack->htb_valuecls)) == NULL)
+		return (-1);
+	DPRINTF("%s: value: %.*s", __func__, (int)hdr->hdr_valuelen, str);
+	hdr->hdr_value = str;
+	hdr->hdr_flags |= borrowed ?
+	    HPACK_HEADER_F_VALUE_BORROWED : HPACK_HEADER_F_VALUE_SHARED;
 
-	/* 6.2.2. Literal Header Field without Indexing */
-	else if ((c & HPACK_M_LITERAL_NO_INDEX) == HPACK_F_LITERAL_NO_INDEX) {
-		DPRINTF("%s: 0x%02x: 6.2.2 literal", __func__, c);
+	return (0);
+}
+
+static int
+hpack_decode_buf(struct hbuf *buf, struct hpack_table *hpack)
+{
+	struct hpack_header		 cbhdr, *hdr = NULL;
+	const struct hpack_octet	*ho;
+	unsigned char			 c;
+	long				 i;
+	size_t				 size;
+	void				*pos = NULL;
+	int				 ret = -1;
+
+	if (hbuf_readchar(buf, &c) == -1)
+		goto done;
+	ho = &hpack_octets[c];
+	if (hpack->htb_hdrarena != NULL)
+		pos = hpack_arena_pos(hpack->htb_hdrarena);
+
+	/* 6.3. Dynamic Table Size Update */
+	if (ho->ho_type == HPACK_T_TABLE_SIZE_UPDATE) {
+		DPRINTF("%s: 0x%02x: 6.3 dynamic table update", __func__, c);
+
+		/* 5 bit index */
+		if ((i = hpack_decode_int(buf, ho->ho_mask)) == -1 ||
+		    hpack_table_setsize(i, hpack) == -1)
+			goto done;
+
+		/* This is not a header */
+		ret = 0;
+		goto done;
+	}
+
+	if (hpack->htb_cb != NULL || hpack->htb_list_full) {
+		/* The callback only gets a temporary header */
+		memset(&cbhdr, 0, sizeof(cbhdr));
+		hdr = &cbhdr;
+	} else if (hpack->htb_hdrarena != NULL) {
+		if ((hdr = hpack_arena_alloc(hpack->htb_hdrarena,
+		    sizeof(*hdr))) == NULL)
+			goto done;
+		memset(hdr, 0, sizeof(*hdr));
+	} else if ((hdr = hpack_header_new()) == NULL)
+		goto done;
+	hdr->hdr_index = ho->ho_index;
+	hpack->htb_next = hdr;
+	hpack->htb_namecls = hpack->htb_valuecls = 0;
+
+	if (ho->ho_type == HPACK_T_INDEX) {
+		/* 6.1 Indexed Header Field Representation */
+		DPRINTF("%s: 0x%02x: 6.1 index", __func__, c);
+
+		if (hpack_decode_index(buf, ho->ho_mask, NULL, hpack) == -1)
+			goto done;
+
+		/* No value means header with empty value */
+		if (hdr->hdr_value == NULL) {
+			hdr->hdr_value = "";
+			hdr->hdr_flags |= HPACK_HEADER_F_VALUE_BORROWED;
+		}
+	} else {
+		/* 6.2 Literal Header Field Representation */
+		DPRINTF("%s: 0x%02x: 6.2 literal (index %d)", __func__,
+		    c, hdr->hdr_index);
+
+		if (hpack_decode_literal(buf, ho->ho_mask, hpack) == -1)
+			goto done;
+	}
+
+	if (hdr->hdr_name == NULL || hdr->hdr_value == NULL)
+		goto done;
+
+	/* Optionally add to index */
+	if (hpack_table_add(hdr, hpack) == -1)
+		goto done;
+
+	/* Account for the header list size (RFC 7540 section 6.5.2) */
+	if (hpack->htb_max_list_size != 0) {
+		size = hdr->hdr_namelen + hdr->hdr_valuelen + 32;
+		if (size > hpack->htb_max_list_size - hpack->htb_list_size)
+			hpack->htb_list_full = 1;
+		else
+			hpack->htb_list_size += size;
+	}
+	if ((hpack->htb_flags & HPACK_TABLE_F_VALIDATE) &&
+	    !hpack->htb_list_full)
+		hpack_decode_check(hdr, hpack);
+	if (hpack->htb_list_full || hpack->htb_error) {
+		/* Keep the table consistent but drop the header */
+		ret = 0;
+		goto done;
+	}
+
+	if (hpack->htb_cb != NULL) {
+		if ((*hpack->htb_cb)(hdr, hpack->htb_cbarg) == -1)
+			goto done;
+	} else {
+		/* Add header to the list */
+		TAILQ_INSERT_TAIL(hpack->htb_headers, hdr, hdr_entry);
+		hdr = NULL;
+	}
+
+	ret = 0;
+ done:
+	if (ret != 0)
+		DPRINTF("%s: failed", __func__);
+	if (hdr != NULL && (hdr == &cbhdr || hpack->htb_hdrarena != NULL))
+		hpack_header_release(hdr);
+	else
+		hpack_header_free(hdr);
+	hpack->htb_next = NULL;
+
+	/* Roll back the arena if the field was incomplete or invalid */
+	if (ret != 0 && hpack->htb_hdrarena != NULL)
+		hpack_arena_trim(hpack->htb_hdrarena, pos, 0);
+
+	return (ret);
+}
+
+unsigned char *
+hpack_encode(struct hpack_headerblock *hdrs, size_t *encoded_len,
+    struct hpack_table *hpack)
+{
+	struct hpack_table		*ctx = NULL;
+	struct hpack_header		*hdr;
+	struct hbuf			*hbuf = NULL;
+	unsigned char			*data = NULL;
+
+	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
+		goto done;
+
+	if ((hbuf = hbuf_new(NULL, BUFSIZ)) == NULL)
+		goto done;
+
+	TAILQ_FOREACH(hdr, hdrs, hdr_entry) {
+		if (hpack_encode_hdr(hbuf, hdr, hpack) == -1)
+			goto done;
+	}
+
+	data = hbuf_release(hbuf, encoded_len);
+	hbuf = NULL;
+ done:
+	hpack_table_free(ctx);
+	hbuf_free(hbuf);
+	return (data);
+}
+
+size_t
+hpack_encode_maxlen(struct hpack_headerblock *hdrs, struct hpack_table *hpack)
+{
+	struct hpack_header	*hdr;
+	size_t			 len = 0, hlen;
+
+	TAILQ_FOREACH(hdr, hdrs, hdr_entry) {
+		hlen = hpack_encode_hdrmaxlen(hdr, hpack);
+		if (hlen > SIZE_MAX - len)
+			return (SIZE_MAX);
+		len += hlen;
+	}
+
+	return (len);
+}
+
+ssize_t
+hpack_encode_into(struct hpack_headerblock *hdrs, unsigned char *out,
+    size_t outsz, struct hpack_table *hpack)
+{
+	struct hpack_table	*ctx = NULL;
+	struct hpack_header	*hdr;
+	struct hbuf		 hbuf;
+	ssize_t			 ret = -1;
 
-		/* 4 bit index */
-		if (hpack_decode_literal(buf,
-		    HPACK_M_LITERAL_NO_INDEX, hpack) == -1)
-			goto fail;
+	/* Check the size before the headers change the table */
+	if (hpack_encode_maxlen(hdrs, hpack) > MIN(outsz, SSIZE_MAX)) {
+		errno = ENOBUFS;
+		return (-1);
 	}
 
-	/* 6.2.3. Literal Header Field Never Indexed */
-	else if ((c & HPACK_M_LITERAL_NO_INDEX) == HPACK_F_LITERAL_NO_INDEX) {
-		DPRINTF("%s: 0x%02x: 6.2.3 literal never indexed", __func__, c);
+	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
+		return (-1);
 
-		/* 4 bit index */
-		if (hpack_decode_literal(buf,
-		    HPACK_M_LITERAL_NO_INDEX, hpack) == -1)
-			goto fail;
-		hdr->hdr_index = HPACK_NEVER_INDEX;
+	hbuf_fixed(&hbuf, out, outsz);
+	TAILQ_FOREACH(hdr, hdrs, hdr_entry) {
+		if (hpack_encode_hdr(&hbuf, hdr, hpack) == -1)
+			goto done;
 	}
 
-	/* 6.3. Dynamic Table Size Update */
-	else if ((c & HPACK_M_TABLE_SIZE_UPDATE) == HPACK_F_TABLE_SIZE_UPDATE) {
-		DPRINTF("%s: 0x%02x: 6.3 dynamic table update", __func__, c);
+	ret = (ssize_t)hbuf.wpos;
+ done:
+	hpack_table_free(ctx);
+	return (ret);
+}
 
-		/* 5 bit index */
-		if ((i = hpack_decode_int(buf,
-		    HPACK_M_TABLE_SIZE_UPDATE)) == -1)
-			goto fail;
+ssize_t
+hpack_encode_iov(struct hpack_headerblock *hdrs, struct iovec *iov,
+    int iovcnt, struct hpack_table *hpack)
+{
+	struct hpack_table	*ctx = NULL;
+	struct hpack_header	*hdr;
+	struct hbuf		 hbuf;
+	size_t			 hlen, left, total = 0;
+	ssize_t			 ret = -1;
+	int			 i;
 
-		if (hpack_table_setsize(i, hpack) == -1)
-			goto fail;
+	if (iovcnt < 1) {
+		errno = EINVAL;
+		return (-1);
+	}
 
-		return (0);
+	/*
+	 * Each header is encoded into the first buffer with enough space
+	 * for its maximum length.  Check that all headers will fit before
+	 * the table is changed, the encoded headers are not longer.
+	 */
+	i = 0;
+	left = iov[0].iov_len;
+	TAILQ_FOREACH(hdr, hdrs, hdr_entry) {
+		hlen = hpack_encode_hdrmaxlen(hdr, hpack);
+		while (hlen > left) {
+			if (++i >= iovcnt) {
+				errno = ENOBUFS;
+				return (-1);
+			}
+			left = iov[i].iov_len;
+		}
+		left -= hlen;
 	}
 
-	/* unknown index */
-	else {
-		DPRINTF("%s: 0x%02x: unknown index", __func__, c);
-		goto fail;
+	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
+		return (-1);
+
+	i = 0;
+	hbuf_fixed(&hbuf, iov[0].iov_base, iov[0].iov_len);
+	TAILQ_FOREACH(hdr, hdrs, hdr_entry) {
+		hlen = hpack_encode_hdrmaxlen(hdr, hpack);
+		while (hlen > hbuf.size - hbuf.wpos) {
+			/* Return the used length and continue in the next */
+			iov[i].iov_len = hbuf.wpos;
+			total += hbuf.wpos;
+			i++;
+			hbuf_fixed(&hbuf, iov[i].iov_base, iov[i].iov_len);
+		}
+		if (hpack_encode_hdr(&hbuf, hdr, hpack) == -1)
+			goto done;
 	}
+	iov[i].iov_len = hbuf.wpos;
+	total += hbuf.wpos;
 
-	if (hdr->hdr_name == NULL || hdr->hdr_value == NULL)
-		goto fail;
+	/* The remaining buffers are not used */
+	while (++i < iovcnt)
+		iov[i].iov_len = 0;
 
-	/* Optionally add to index */
-	if (hpack_table_add(hdr, hpack) == -1)
-		goto fail;
+	ret = total > SSIZE_MAX ? -1 : (ssize_t)total;
+ done:
+	hpack_table_free(ctx);
+	return (ret);
+}
 
-	/* Add header to the list */
-	TAILQ_INSERT_TAIL(hpack->htb_headers, hdr, hdr_entry);
-	hpack->htb_next = NULL;
+static void
+hpack_encode_lengths(const struct hpack_header *hdr, size_t *namelen,
+    size_t *valuelen)
+{
+	/* Headers that were not added by the API have no lengths */
+	*namelen = hdr->hdr_namelen;
+	if (*namelen == 0 && hdr->hdr_name != NULL &&
+	    (hdr->hdr_flags & HPACK_HEADER_F_NAME_BORROWED) == 0)
+		*namelen = strlen(hdr->hdr_name);
+	*valuelen = hdr->hdr_valuelen;
+	if (*valuelen == 0 && hdr->hdr_value != NULL &&
+	    (hdr->hdr_flags & HPACK_HEADER_F_VALUE_BORROWED) == 0)
+		*valuelen = strlen(hdr->hdr_value);
+}
 
-	return (0);
- fail:
-	DPRINTF("%s: failed", __func__);
-	hpack_header_free(hdr);
-	hpack->htb_next = NULL;
+static size_t
+hpack_encode_hdrmaxlen(const struct hpack_header *hdr,
+    struct hpack_table *hpack)
+{
+	size_t		 maxid, len, n, namelen, valuelen;
+
+	/* Don't change the header before it is encoded */
+	hpack_encode_lengths(hdr, &namelen, &valuelen);
 
-	return (-1);
+	/* Entries take at least 32 bytes of the dynamic table */
+	maxid = HPACK_STATIC_SIZE + (hpack == NULL ? HPACK_MAX_TABLE_SIZE :
+	    (size_t)hpack->htb_max_table_size) / 32;
+
+	/*
+	 * The longest representation is a literal with a new name
+	 * or with the largest index of the name that is possible.
+	 * Huffman code is only used if it is shorter than the string.
+	 */
+	len = hpack_encode_intlen(maxid, HPACK_M_LITERAL_NO_INDEX);
+	n = hpack_encode_intlen(namelen, HPACK_M_LITERAL);
+	if (namelen > SIZE_MAX - len - n)
+		return (SIZE_MAX);
+	len += n + namelen;
+	n = hpack_encode_intlen(valuelen, HPACK_M_LITERAL);
+	if (valuelen > SIZE_MAX - len - n)
+		return (SIZE_MAX);
+	len += n + valuelen;
+
+	return (len);
 }
 
-unsigned char *
-hpack_encode(struct hpack_headerblock *hdrs, size_t *encoded_len,
+static int
+hpack_encode_hdr(struct hbuf *hbuf, struct hpack_header *hdr,
     struct hpack_table *hpack)
 {
 	const struct hpack_index	*id;
 	struct hpack_index		 idbuf;
-	struct hpack_table		*ctx = NULL;
-	struct hpack_header		*hdr;
-	struct hbuf			*hbuf = NULL;
 	unsigned char			 mask, flag;
 
-	if (hpack == NULL && (hpack = ctx = hpack_table_new(0)) == NULL)
-		goto fail;
+	hpack_encode_lengths(hdr, &hdr->hdr_namelen, &hdr->hdr_valuelen);
+
+	DPRINTF("%s: header %.*s: %.*s (index %d)", __func__,
+	    (int)hdr->hdr_namelen, hdr->hdr_name,
+	    (int)hdr->hdr_valuelen,
+	    hdr->hdr_value == NULL ? "" : hdr->hdr_value,
+	    hdr->hdr_index);
+
+	switch (hdr->hdr_index) {
+	case HPACK_INDEX:
+		mask = HPACK_M_LITERAL_INDEX;
+		flag = HPACK_F_LITERAL_INDEX;
+		break;
+	case HPACK_NO_INDEX:
+	default:
+		mask = HPACK_M_LITERAL_NO_INDEX;
+		flag = HPACK_F_LITERAL_NO_INDEX;
+		break;
+	case HPACK_NEVER_INDEX:
+		mask = HPACK_M_LITERAL_NEVER_INDEX;
+		flag = HPACK_F_LITERAL_NEVER_INDEX;
+		break;
+	}
 
-	if ((hbuf = hbuf_new(NULL, BUFSIZ)) == NULL)
-		goto fail;
+	id = hpack_table_getbyheader(hdr, &idbuf, hpack);
 
-	TAILQ_FOREACH(hdr, hdrs, hdr_entry) {
-		DPRINTF("%s: header %s: %s (index %d)", __func__,
-		    hdr->hdr_name,
-		    hdr->hdr_value == NULL ? "(null)" : hdr->hdr_value,
-		    hdr->hdr_index);
-
-		switch (hdr->hdr_index) {
-		case HPACK_INDEX:
-			mask = HPACK_M_LITERAL_INDEX;
-			flag = HPACK_F_LITERAL_INDEX;
-			break;
-		case HPACK_NO_INDEX:
-			mask = HPACK_M_LITERAL_NO_INDEX;
-			flag = HPACK_F_LITERAL_NO_INDEX;
-			break;
-		case HPACK_NEVER_INDEX:
-			mask = HPACK_M_LITERAL_NEVER_INDEX;
-			flag = HPACK_F_LITERAL_NEVER_INDEX;
-			break;
-		}
+	/* 6.1 Indexed Header Field Representation */
+	if (id != NULL && id->hpi_value != NULL) {
+		DPRINTF("%s: index %zu (%s: %s)", __func__,
+		    id->hpi_id,
+		    id->hpi_name,
+		    id->hpi_value == NULL ? "(null)" : id->hpi_value);
+		return (hpack_encode_int(hbuf, id->hpi_id,
+		    HPACK_M_INDEX, HPACK_F_INDEX));
+	}
 
-		id = hpack_table_getbyheader(hdr, &idbuf, hpack);
+	/* 6.2 Literal Header Field Representation */
+	else if (id != NULL) {
+		DPRINTF("%s: index+name %zu, %.*s", __func__,
+		    id->hpi_id,
+		    (int)hdr->hdr_valuelen, hdr->hdr_value);
 
-		/* 6.1 Indexed Header Field Representation */
-		if (id != NULL && id->hpi_value != NULL) {
-			DPRINTF("%s: index %zu (%s: %s)", __func__,
-			    id->hpi_id,
-			    id->hpi_name,
-			    id->hpi_value == NULL ? "(null)" : id->hpi_value);
-			if (hpack_encode_int(hbuf, id->hpi_id,
-			    HPACK_M_INDEX, HPACK_F_INDEX) == -1)
-				goto fail;
-			continue;
-		}
+		if (hpack_encode_int(hbuf, id->hpi_id,
+		    mask, flag) == -1)
+			return (-1);
+	} else {
+		DPRINTF("%s: literal %.*s: %.*s", __func__,
+		    (int)hdr->hdr_namelen, hdr->hdr_name,
+		    (int)hdr->hdr_valuelen, hdr->hdr_value);
 
-		/* 6.2 Literal Header Field Representation */
-		else if (id != NULL) {
-			DPRINTF("%s: index+name %zu, %s", __func__,
-			    id->hpi_id,
-			    hdr->hdr_value);
+		if (hpack_encode_int(hbuf, 0, mask, flag) == -1)
+			return (-1);
 
-			if (hpack_encode_int(hbuf, id->hpi_id,
-			    mask, flag) == -1)
-				goto fail;
-		} else {
-			DPRINTF("%s: literal %s: %s", __func__,
-			    hdr->hdr_name,
-			    hdr->hdr_value);
+		/* name */
+		if (hpack_encode_str(hbuf, hdr->hdr_name,
+		    hdr->hdr_namelen) == -1)
+			return (-1);
+	}
 
-			if (hpack_encode_int(hbuf, 0, mask, flag) == -1)
-				goto fail;
+	/* value */
+	if (hpack_encode_str(hbuf, hdr->hdr_value,
+	    hdr->hdr_valuelen) == -1)
+		return (-1);
 
-			/* name */
-			if (hpack_encode_str(hbuf, hdr->hdr_name) == -1)
-				goto fail;
-		}
+	/* Optionally add to index */
+	return (hpack_table_add(hdr, hpack));
+}
 
-		/* value */
-		if (hpack_encode_str(hbuf, hdr->hdr_value) == -1)
-			goto fail;
+static size_t
+hpack_encode_intlen(size_t i, unsigned char prefix)
+{
+	unsigned char	m = ~prefix;
+	size_t		len = 1;
 
-		/* Optionally add to index */
-		if (hpack_table_add(hdr, hpack) == -1)
-			goto fail;
-	}
+	/* Same as hpack_encode_int() without writing the octets */
+	if (i < m)
+		return (len);
+	for (i -= m; i >= 0x80; i /= 0x80)
+		len++;
 
-	return (hbuf_release(hbuf, encoded_len));
- fail:
-	hpack_table_free(ctx);
-	hbuf_free(hbuf);
-	return (NULL);
+	return (len + 1);
 }
 
 static int
@@ -728,262 +1878,394 @@ hpack_encode_int(struct hbuf *buf, long i, unsigned char prefix,
 
 	/* The first octet encodes up to prefix length bits */
 	m = ~prefix;
-	if (i <= m)
-		b = (i & m) | type;
-	else
-		b = m | type;
+	if (i < m)
+		return (hbuf_writechar(buf, (i & m) | type));
+	b = m | type;
 	if (hbuf_writechar(buf, b) == -1)
 		return (-1);
 	i -= m;
 
 	/* Encode the remainder as a varint */
 	for (m = 0x80; i >= m; i /= m) {
-		b = i % m + m;
 		/* Set the continuation bit if there are steps left */
-		if (i >= m)
-			b |= m;
+		b = i % m + m;
 		if (hbuf_writechar(buf, b) == -1)
 			return (-1);
 	}
-	if (i > 0 &&
-	    hbuf_writechar(buf, (unsigned char)i) == -1)
-		return (-1);
 
-	return (0);
+	/* The last octet, which is 0 if the value filled the prefix */
+	return (hbuf_writechar(buf, (unsigned char)i));
 }
 
 static int
-hpack_encode_str(struct hbuf *buf, char *str)
+hpack_encode_str(struct hbuf *buf, const char *str, size_t slen)
 {
-	unsigned char	*data = NULL;
-	size_t		 len, slen;
-	int		 ret = -1;
+	const unsigned char	*s = (const unsigned char *)str;
+	unsigned char		*data;
+	size_t			 len;
 
 	/*
 	 * We have to decide if the string should be encoded with huffman
 	 * encoding or as literal string.  There could be better heuristics
 	 * to do this...
 	 */
-	slen = strlen(str);
-	if ((data = hpack_huffman_encode(str, slen, &len)) == NULL)
-		goto done;
-	if (len > 0 && len < slen) {
+	len = hpack_huffman_encoded_len(s, slen);
+	if (len < slen) {
 		DPRINTF("%s: encoded huffman code (size %ld, from %ld)",
 		    __func__, len, slen);
 		if (hpack_encode_int(buf, len, HPACK_M_LITERAL,
 		    HPACK_F_LITERAL_HUFFMAN) == -1)
-			goto done;
-		if (hbuf_writebuf(buf, data, len) == -1)
-			goto done;
+			return (-1);
+		if (hbuf_reserve(buf, &data, len) == -1)
+			return (-1);
+		hpack_huffman_write(s, slen, data);
 	} else {
 		if (hpack_encode_int(buf, slen, HPACK_M_LITERAL,
 		    HPACK_F_LITERAL) == -1)
-			goto done;
-		if (hbuf_writebuf(buf, str, slen) == -1)
-			goto done;
+			return (-1);
+		if (hbuf_writebuf(buf, s, slen) == -1)
+			return (-1);
 	}
 
-	ret = 0;
- done:
-	free(data);
-	return (ret);
+	return (0);
 }
 
-static int
-hpack_huffman_init(void)
+ssize_t
+hpack_huffman_decode_into(const unsigned char *buf, size_t len,
+    unsigned char *out, size_t outsz)
+{
+	unsigned char	 cls;
+
+	return (hpack_huffman_decode_class(buf, len, out, outsz, &cls));
+}
+
+#ifdef HPACK_HUFFMAN_TREE
+static ssize_t
+hpack_huffman_decode_class(const unsigned char *buf, size_t len,
+    unsigned char *out, size_t outsz, unsigned char *cls)
 {
-	struct hpack_huffman		*hph;
-	struct hpack_huffman_node	*root, *cur, *node;
-	unsigned int			 i, j;
+	unsigned int			 j, code, bit;
+	unsigned int			 node = 0, child, depth = 0, ones = 1;
+	size_t				 i, o = 0;
+
+	/* Each symbol is encoded with at least 5 bits */
+	*cls = 0;
+	if (len > SSIZE_MAX / 8)
+		return (-1);
+
+	for (i = 0; i < len; i++) {
+		code = buf[i];
+
+		/* Walk the Huffman tree for each bit in the encoded input */
+		for (j = 8; j > 0; j--) {
+			bit = (code >> (j - 1)) & 1;
+			child = huffman_decode_tree[node].hpn_child[bit];
+			depth++;
+			ones &= bit;
+			if ((child & HPACK_HUFFMAN_F_LEAF) == 0) {
+				node = child;
+				continue;
+			}
+			child &= ~HPACK_HUFFMAN_F_LEAF;
+
+			/* EOS must not be part of the encoded string */
+			if (child == HPACK_HUFFMAN_SIZE - 1)
+				return (-1);
+
+			/* Leaf node of the next (8-bit ASCII) symbol */
+			if (o < outsz)
+				out[o] = (unsigned char)child;
+			*cls |= hpack_chars[child];
+			o++;
+			node = depth = 0;
+			ones = 1;
+		}
+	}
+
+	/* Padding must be shorter than 8 bits and match the EOS prefix */
+	if (depth > 7 || !ones) {
+		DPRINTF("%s: invalid padding", __func__);
+		return (-1);
+	}
 
-	/* Create new Huffman tree */
-	if ((root = hpack_huffman_new()) == NULL)
+	return ((ssize_t)o);
+}
+#else
+static ssize_t
+hpack_huffman_decode_class(const unsigned char *buf, size_t len,
+    unsigned char *out, size_t outsz, unsigned char *cls)
+{
+	const struct hpack_huffman_fast		*hpf;
+	const struct hpack_huffman_state	*hps;
+	unsigned char				 state;
+	uint64_t				 bits = 0;
+	unsigned int				 nbits = 0, n, code;
+	size_t					 i = 0, o = 0;
+	unsigned char				 c = 0;
+
+	/* Each symbol is encoded with at least 5 bits */
+	*cls = 0;
+	if (len > SSIZE_MAX / 8)
 		return (-1);
 
-	for (i = 0; i < HPACK_HUFFMAN_SIZE; i++) {
-		hph = &huffman_table[i];
-		cur = root;
-
-		/* Create branch for each symbol */
-		for (j = hph->hph_length; j > 0; j--) {
-			if ((hph->hph_code >> (j - 1)) & 1) {
-				if (cur->hpn_one == NULL) {
-					if ((node =
-					    hpack_huffman_new()) == NULL)
-						goto fail;
-					cur->hpn_one = node;
-				}
-				cur = cur->hpn_one;
-			} else {
-				if (cur->hpn_zero == NULL) {
-					if ((node =
-					    hpack_huffman_new()) == NULL)
-						goto fail;
-					cur->hpn_zero = node;
-				}
-				cur = cur->hpn_zero;
+	for (;;) {
+		/* Fill the 64-bit accumulator with input octets (MSB first) */
+		while (nbits <= 56 && i < len) {
+			bits |= (uint64_t)buf[i++] << (56 - nbits);
+			nbits += 8;
+		}
+		if (nbits == 0)
+			break;
+
+		/* Lookup of the next bits, the end is padded with EOS */
+		code = bits >> (64 - HPACK_HUFFMAN_FAST_BITS);
+		if (nbits < HPACK_HUFFMAN_FAST_BITS)
+			code |= (1 << (HPACK_HUFFMAN_FAST_BITS - nbits)) - 1;
+		hpf = &huffman_decode_fast[code];
+
+		if (hpf->hpf_bits[1] != 0 && hpf->hpf_bits[1] <= nbits) {
+			if (o + 1 < outsz) {
+				out[o] = hpf->hpf_sym[0];
+				out[o + 1] = hpf->hpf_sym[1];
+			} else if (o < outsz)
+				out[o] = hpf->hpf_sym[0];
+			c |= hpack_chars[hpf->hpf_sym[0]] |
+			    hpack_chars[hpf->hpf_sym[1]];
+			o += 2;
+			n = hpf->hpf_bits[1];
+		} else if (hpf->hpf_bits[0] != 0 && hpf->hpf_bits[0] <= nbits) {
+			if (o < outsz)
+				out[o] = hpf->hpf_sym[0];
+			c |= hpack_chars[hpf->hpf_sym[0]];
+			o++;
+			n = hpf->hpf_bits[0];
+		} else if (nbits < HPACK_HUFFMAN_FAST_BITS) {
+			/*
+			 * Padding must be shorter than 8 bits and
+			 * match the EOS prefix.
+			 */
+			if (nbits > 7 ||
+			    (bits >> (64 - nbits)) != (1U << nbits) - 1) {
+				DPRINTF("%s: invalid padding", __func__);
+				return (-1);
 			}
+			break;
+		} else {
+			/* Slow path for the rare long codes */
+			state = hpf->hpf_sym[0];
+			bits <<= HPACK_HUFFMAN_FAST_BITS;
+			nbits -= HPACK_HUFFMAN_FAST_BITS;
+
+			for (;;) {
+				code = bits >> 60;
+				if (nbits < 4)
+					code |= (1 << (4 - nbits)) - 1;
+				hps = &huffman_decode_states[state][code];
+				if (hps->hps_flags & HPACK_HUFFMAN_F_FAIL)
+					return (-1);
+				if (hps->hps_flags & HPACK_HUFFMAN_F_EMIT)
+					break;
+
+				/* The input ended within the code */
+				if (nbits < 4)
+					return (-1);
+				state = hps->hps_state;
+				bits <<= 4;
+				nbits -= 4;
+			}
+			if (hps->hps_bits > nbits)
+				return (-1);
+			if (o < outsz)
+				out[o] = hps->hps_sym;
+			c |= hpack_chars[hps->hps_sym];
+			o++;
+			n = hps->hps_bits;
 		}
 
-		/* The leaf node contains the (8-bit ASCII) symbol */
-		cur->hpn_sym = i;
+		bits <<= n;
+		nbits -= n;
 	}
+	*cls = c;
 
-	hpack_global.hpack_huffman = root;
-	return (0);
- fail:
-	hpack_huffman_free(root);
-	hpack_global.hpack_huffman = NULL;
-	return (-1);
+	return ((ssize_t)o);
 }
+#endif /* HPACK_HUFFMAN_TREE */
 
 unsigned char *
 hpack_huffman_decode(unsigned char *buf, size_t len, size_t *decoded_len)
 {
-	struct hpack_huffman_node	*node, *root;
-	unsigned int			 i, j, code;
-	struct hbuf			*hbuf = NULL;
+	unsigned char	*data, *ptr;
+	size_t		 size;
+	ssize_t		 ret;
 
-	if ((root = node = hpack_global.hpack_huffman) == NULL)
-		errx(1, "hpack not initialized");
+	*decoded_len = 0;
 
-	if ((hbuf = hbuf_new(NULL, len)) == NULL)
+	/* Each symbol is encoded with at least 5 bits */
+	if (len > SSIZE_MAX / 8)
 		return (NULL);
+	size = MAX(len * 8 / 5, 1);
+	if ((data = malloc(size)) == NULL)
+		return (NULL);
+	if ((ret = hpack_huffman_decode_into(buf, len, data, size)) == -1) {
+		free(data);
+		return (NULL);
+	}
 
-	for (i = 0; i < len; i++) {
-		code = buf[i];
-
-		/* Walk the Huffman tree for each bit in the encoded input */
-		for (j = 8; j > 0; j--) {
-			if ((code >> (j - 1)) & 1)
-				node = node->hpn_one;
-			else
-				node = node->hpn_zero;
-			if (node->hpn_sym == -1)
-				continue;
-
-			/* Leaf node of the next (8-bit ASCII) symbol */
-			if (hbuf_writechar(hbuf,
-			    (unsigned char)node->hpn_sym) == -1) {
-				DPRINTF("%s: failed to add '%c'", __func__,
-				    node->hpn_sym);
-				goto fail;
-			}
-			node = root;
+	/*
+	 * Adjust (shrink) buffer to the used size.  This allows to
+	 * safely call recallocarray() or freezero() later.
+	 */
+	if ((size_t)ret != size) {
+		if ((ptr = recallocarray(data, size, ret, 1)) == NULL) {
+			freezero(data, size);
+			return (NULL);
 		}
+		data = ptr;
 	}
 
-	return (hbuf_release(hbuf, decoded_len));
- fail:
-	*decoded_len = 0;
-	hbuf_free(hbuf);
-	return (NULL);
+	*decoded_len = ret;
+	return (data);
 }
 
 char *
 hpack_huffman_decode_str(unsigned char *buf, size_t len)
 {
-	unsigned char	*data;
-	char		*str;
-	size_t		 data_len;
+	char		*str, *ptr;
+	size_t		 size;
+	ssize_t		 ret;
+	unsigned char	 cls;
 
-	if ((data = hpack_huffman_decode(buf, len, &data_len)) == NULL)
+	/* Each symbol is encoded with at least 5 bits */
+	if (len > SSIZE_MAX / 8)
 		return (NULL);
 
 	/* Allocate with an extra NUL character */
-	if ((str = recallocarray(data, data_len, data_len + 1, 1)) == NULL) {
-		freezero(data, data_len);
+	size = len * 8 / 5 + 1;
+	if ((str = malloc(size)) == NULL)
 		return (NULL);
-	}
+	if ((ret = hpack_huffman_decode_class(buf, len,
+	    (unsigned char *)str, size - 1, &cls)) == -1)
+		goto fail;
+	str[ret] = '\0';
 
 	/* Check if this is an actual string (no matter of the encoding) */
-	if (strlen(str) != data_len) {
-		freezero(str, data_len + 1);
-		str = NULL;
+	if (cls & HPACK_C_NUL)
+		goto fail;
+
+	if ((size_t)ret + 1 != size) {
+		if ((ptr = recallocarray(str, size, ret + 1, 1)) == NULL)
+			goto fail;
+		str = ptr;
 	}
 
 	return (str);
+ fail:
+	freezero(str, size);
+	return (NULL);
 }
 
-unsigned char *
-hpack_huffman_encode(unsigned char *data, size_t len, size_t *encoded_len)
+size_t
+hpack_huffman_encoded_len(const unsigned char *data, size_t len)
 {
-	struct hbuf		*hbuf;
-	struct hpack_huffman	*hph;
-	unsigned int		 code, i, j;
-	unsigned char		 o, obits;
+	size_t		 i, b0 = 0, b1 = 0, b2 = 0, b3 = 0;
 
-	if ((hbuf = hbuf_new(NULL, len)) == NULL)
-		return (NULL);
+	/*
+	 * Sum the length of the codes in four independent sums,
+	 * this lets long values (cookies, tokens) use more ILP.
+	 */
+	for (i = 0; i + 4 <= len; i += 4) {
+		b0 += huffman_table[data[i]].hph_length;
+		b1 += huffman_table[data[i + 1]].hph_length;
+		b2 += huffman_table[data[i + 2]].hph_length;
+		b3 += huffman_table[data[i + 3]].hph_length;
+	}
+	for (; i < len; i++)
+		b0 += huffman_table[data[i]].hph_length;
 
-	for (i = 0, o = 0, obits = 8; i < len; i++) {
-		/* Get Huffman code for each (8-bit ASCII) symbol */
-		hph = &huffman_table[data[i]];
+	return ((b0 + b1 + b2 + b3 + 7) / 8);
+}
 
-		for (code = hph->hph_code, j = hph->hph_length; j > 0;) {
-			if (j > obits) {
-				/* More bits to encode for this symbol */
-				j -= obits;
-				o |= (code >> j) & 0xff;
-				obits = 0;
-			} else {
-				/*
-				 * Remaining bits to encode for this input
-				 * symbol.  The current output octet will
-				 * include bits from the next symbol or padding.
-				 */
-				obits -= j;
-				o |= (code << obits) & 0xff;
-				j = 0;
-			}
-			if (obits == 0) {
-				if (hbuf_writechar(hbuf, o) == -1) {
-					DPRINTF("%s: failed to add '%c'",
-					    __func__, o);
-					goto fail;
-				}
-				o = 0;
-				obits = 8;
-			}
-		}
-	}
+unsigned char *
+hpack_huffman_encode(unsigned char *data, size_t len, size_t *encoded_len)
+{
+	unsigned char	*buf;
+	size_t		 enclen;
 
-	if (len && obits > 0 && obits < 8) {
-		/* Pad last octet with ones (EOS) */
-		o |= (1 << obits) - 1;
-		if (hbuf_writechar(hbuf, o) == -1) {
-			DPRINTF("%s: failed to add '%c'", __func__, o);
-			goto fail;
-		}
+	enclen = hpack_huffman_encoded_len(data, len);
+	if ((buf = malloc(MAX(enclen, 1))) == NULL) {
+		*encoded_len = 0;
+		return (NULL);
 	}
+	hpack_huffman_write(data, len, buf);
 
-	return (hbuf_release(hbuf, encoded_len));
- fail:
-	*encoded_len = 0;
-	hbuf_free(hbuf);
-	return (NULL);
+	*encoded_len = enclen;
+	return (buf);
 }
 
-static struct hpack_huffman_node *
-hpack_huffman_new(void)
+ssize_t
+hpack_huffman_encode_into(const unsigned char *data, size_t len,
+    unsigned char *out, size_t outsz)
 {
-	struct hpack_huffman_node	*node;
+	size_t		 enclen;
 
-	if ((node = calloc(1, sizeof(*node))) == NULL)
-		return (NULL);
-	node->hpn_sym = -1;
+	/* Return the required size if the output buffer is too small */
+	enclen = hpack_huffman_encoded_len(data, len);
+	if (enclen > SSIZE_MAX)
+		return (-1);
+	if (enclen <= outsz)
+		hpack_huffman_write(data, len, out);
 
-	return (node);
+	return ((ssize_t)enclen);
 }
 
 static void
-hpack_huffman_free(struct hpack_huffman_node *root)
+hpack_huffman_write(const unsigned char *data, size_t len, unsigned char *out)
 {
-	if (root == NULL)
-		return;
-	hpack_huffman_free(root->hpn_zero);
-	hpack_huffman_free(root->hpn_one);
-	free(root);
+	const struct hpack_huffman	*hph;
+	uint64_t			 bits = 0, code;
+	uint32_t			 word;
+	unsigned int			 nbits = 0, n, pad;
+	size_t				 i, next;
+
+	for (i = 0; i < len; i = next) {
+		/* Get Huffman code for each (8-bit ASCII) symbol */
+		hph = &huffman_table[data[i]];
+		code = hph->hph_code;
+		n = hph->hph_length;
+		next = i + 1;
+
+		/* Combine it with the next code if both fit in 32 bits */
+		if (next < len) {
+			hph = &huffman_table[data[next]];
+			if (n + hph->hph_length <= 32) {
+				code = (code << hph->hph_length) | hph->hph_code;
+				n += hph->hph_length;
+				next++;
+			}
+		}
+
+		/* Append the codes to the LSB of the 64-bit accumulator */
+		bits = (bits << n) | code;
+		nbits += n;
+
+		/* Flush 32 bits at once, this leaves up to 31 bits */
+		if (nbits >= 32) {
+			nbits -= 32;
+			word = htonl((uint32_t)(bits >> nbits));
+			memcpy(out, &word, sizeof(word));
+			out += sizeof(word);
+		}
+	}
+
+	/* Pad the last octet with ones (EOS) */
+	if ((pad = (8 - (nbits % 8)) % 8) != 0) {
+		bits = (bits << pad) | ((1U << pad) - 1);
+		nbits += pad;
+	}
+	while (nbits > 0) {
+		nbits -= 8;
+		*out++ = (bits >> nbits) & 0xff;
+	}
 }
 
 static struct hbuf *
@@ -1007,6 +2289,24 @@ hbuf_new(unsigned char *data, size_t len)
 	return (buf);
 }
 
+static void
+hbuf_view(struct hbuf *buf, unsigned char *data, size_t len)
+{
+	/* Read-only buffer that refers to the data without a copy */
+	memset(buf, 0, sizeof(*buf));
+	buf->data = data;
+	buf->size = buf->wpos = len;
+}
+
+static void
+hbuf_fixed(struct hbuf *buf, unsigned char *data, size_t size)
+{
+	/* Write buffer in the caller's memory that cannot grow */
+	memset(buf, 0, sizeof(*buf));
+	buf->data = data;
+	buf->size = size;
+}
+
 static void
 hbuf_free(struct hbuf *buf)
 {
@@ -1022,8 +2322,15 @@ hbuf_realloc(struct hbuf *buf, size_t len)
 	unsigned char	*ptr;
 	size_t		 newsize;
 
-	/* Allocate a multiple of the initial write buffer size */
-	newsize = (buf->size + len + (buf->wbsz - 1)) & ~(buf->wbsz - 1);
+	/* Views and fixed buffers are not allocated */
+	if (buf->wbsz == 0)
+		return (-1);
+
+	/* Grow exponentially in multiples of the initial write buffer size */
+	if (len > SIZE_MAX / 2 - buf->size)
+		return (-1);
+	newsize = MAX(buf->size * 2, buf->size + len);
+	newsize = (newsize + buf->wbsz - 1) / buf->wbsz * buf->wbsz;
 
 	DPRINTF("%s: size %zu -> %zu", __func__, buf->size, newsize);
 
@@ -1042,7 +2349,7 @@ hbuf_writechar(struct hbuf *buf, unsigned char c)
 }
 
 static int
-hbuf_writebuf(struct hbuf *buf, unsigned char *data, size_t len)
+hbuf_writebuf(struct hbuf *buf, const unsigned char *data, size_t len)
 {
 	if ((buf->wpos + len > buf->size) &&
 	    hbuf_realloc(buf, len) == -1)
@@ -1054,6 +2361,20 @@ hbuf_writebuf(struct hbuf *buf, unsigned char *data, size_t len)
 	return (0);
 }
 
+static int
+hbuf_reserve(struct hbuf *buf, unsigned char **ptr, size_t len)
+{
+	/* Return a pointer to len bytes at the write position */
+	if ((buf->wpos + len > buf->size) &&
+	    hbuf_realloc(buf, len) == -1)
+		return (-1);
+
+	*ptr = buf->data + buf->wpos;
+	buf->wpos += len;
+
+	return (0);
+}
+
 static unsigned char *
 hbuf_release(struct hbuf *buf, size_t *len)
 {
@@ -1082,8 +2403,10 @@ hbuf_release(struct hbuf *buf, size_t *len)
 static int
 hbuf_readchar(struct hbuf *buf, unsigned char *c)
 {
-	if (buf->rpos + 1 > buf->size)
+	if (buf->rpos + 1 > buf->wpos) {
+		buf->eof = 1;
 		return (-1);
+	}
 	*c = *(buf->data + buf->rpos);
 	return (0);
 }
@@ -1091,8 +2414,10 @@ hbuf_readchar(struct hbuf *buf, unsigned char *c)
 static int
 hbuf_readbuf(struct hbuf *buf, unsigned char **ptr, size_t len)
 {
-	if (buf->rpos + len > buf->size)
+	if (len > buf->wpos - buf->rpos) {
+		buf->eof = 1;
 		return (-1);
+	}
 	*ptr = buf->data + buf->rpos;
 	return (0);
 }
@@ -1100,8 +2425,10 @@ hbuf_readbuf(struct hbuf *buf, unsigned char **ptr, size_t len)
 static int
 hbuf_advance(struct hbuf *buf, size_t len)
 {
-	if (buf->rpos + len > buf->size)
+	if (len > buf->wpos - buf->rpos) {
+		buf->eof = 1;
 		return (-1);
+	}
 	buf->rpos += len;
 	return (0);
 }
@@ -22,6 +22,8 @@
 #define HPACK_H
 
 struct hpack_table;
+struct hpack_arena;
+struct iovec;
 
 enum hpack_header_index {
 	HPACK_NO_INDEX = 0,
@@ -29,10 +31,75 @@ enum hpack_header_index {
 	HPACK_INDEX,
 };
 
+/* Well-known header names, the first index in the static table */
+enum hpack_header_token {
+	HPACK_TOKEN_NONE			= 0,
+	HPACK_TOKEN_AUTHORITY			= 1,
+	HPACK_TOKEN_METHOD			= 2,
+	HPACK_TOKEN_PATH			= 4,
+	HPACK_TOKEN_SCHEME			= 6,
+	HPACK_TOKEN_STATUS			= 8,
+	HPACK_TOKEN_ACCEPT_CHARSET		= 15,
+	HPACK_TOKEN_ACCEPT_ENCODING		= 16,
+	HPACK_TOKEN_ACCEPT_LANGUAGE		= 17,
+	HPACK_TOKEN_ACCEPT_RANGES		= 18,
+	HPACK_TOKEN_ACCEPT			= 19,
+	HPACK_TOKEN_ACCESS_CONTROL_ALLOW_ORIGIN	= 20,
+	HPACK_TOKEN_AGE				= 21,
+	HPACK_TOKEN_ALLOW			= 22,
+	HPACK_TOKEN_AUTHORIZATION		= 23,
+	HPACK_TOKEN_CACHE_CONTROL		= 24,
+	HPACK_TOKEN_CONTENT_DISPOSITION		= 25,
+	HPACK_TOKEN_CONTENT_ENCODING		= 26,
+	HPACK_TOKEN_CONTENT_LANGUAGE		= 27,
+	HPACK_TOKEN_CONTENT_LENGTH		= 28,
+	HPACK_TOKEN_CONTENT_LOCATION		= 29,
+	HPACK_TOKEN_CONTENT_RANGE		= 30,
+	HPACK_TOKEN_CONTENT_TYPE		= 31,
+	HPACK_TOKEN_COOKIE			= 32,
+	HPACK_TOKEN_DATE			= 33,
+	HPACK_TOKEN_ETAG			= 34,
+	HPACK_TOKEN_EXPECT			= 35,
+	HPACK_TOKEN_EXPIRES			= 36,
+	HPACK_TOKEN_FROM			= 37,
+	HPACK_TOKEN_HOST			= 38,
+	HPACK_TOKEN_IF_MATCH			= 39,
+	HPACK_TOKEN_IF_MODIFIED_SINCE		= 40,
+	HPACK_TOKEN_IF_NONE_MATCH		= 41,
+	HPACK_TOKEN_IF_RANGE			= 42,
+	HPACK_TOKEN_IF_UNMODIFIED_SINCE		= 43,
+	HPACK_TOKEN_LAST_MODIFIED		= 44,
+	HPACK_TOKEN_LINK			= 45,
+	HPACK_TOKEN_LOCATION			= 46,
+	HPACK_TOKEN_MAX_FORWARDS		= 47,
+	HPACK_TOKEN_PROXY_AUTHENTICATE		= 48,
+	HPACK_TOKEN_PROXY_AUTHORIZATION		= 49,
+	HPACK_TOKEN_RANGE			= 50,
+	HPACK_TOKEN_REFERER			= 51,
+	HPACK_TOKEN_REFRESH			= 52,
+	HPACK_TOKEN_RETRY_AFTER			= 53,
+	HPACK_TOKEN_SERVER			= 54,
+	HPACK_TOKEN_SET_COOKIE			= 55,
+	HPACK_TOKEN_STRICT_TRANSPORT_SECURITY	= 56,
+	HPACK_TOKEN_TRANSFER_ENCODING		= 57,
+	HPACK_TOKEN_USER_AGENT			= 58,
+	HPACK_TOKEN_VARY			= 59,
+	HPACK_TOKEN_VIA				= 60,
+	HPACK_TOKEN_WWW_AUTHENTICATE		= 61
+};
+
 struct hpack_header {
-	char				*hdr_name;
-	char				*hdr_value;
+	const char			*hdr_name;
+	const char			*hdr_value;
+	size_t				 hdr_namelen;
+	size_t				 hdr_valuelen;
 	enum hpack_header_index		 hdr_index;
+	enum hpack_header_token		 hdr_token;
+	unsigned int			 hdr_flags;
+#define HPACK_HEADER_F_NAME_SHARED	0x01	/* shared name string */
+#define HPACK_HEADER_F_VALUE_SHARED	0x02	/* shared value string */
+#define HPACK_HEADER_F_NAME_BORROWED	0x04	/* name view, not owned */
+#define HPACK_HEADER_F_VALUE_BORROWED	0x08	/* value view, not owned */
 	TAILQ_ENTRY(hpack_header)	 hdr_entry;
 };
 TAILQ_HEAD(hpack_headerblock, hpack_header);
@@ -43,12 +110,33 @@ struct hpack_table
 	*hpack_table_new(size_t);
 void	 hpack_table_free(struct hpack_table *);
 size_t	 hpack_table_size(struct hpack_table *);
+void	 hpack_table_setflags(struct hpack_table *, unsigned int);
+#define HPACK_TABLE_F_VIEW		0x01	/* decode into views */
+#define HPACK_TABLE_F_VALIDATE		0x02	/* validate HTTP/2 fields */
+void	 hpack_table_setarena(struct hpack_table *, struct hpack_arena *);
+void	 hpack_table_setmaxlistsize(struct hpack_table *, size_t);
+
+struct hpack_arena
+	*hpack_arena_new(size_t);
+void	 hpack_arena_reset(struct hpack_arena *);
+void	 hpack_arena_free(struct hpack_arena *);
 
 struct hpack_headerblock
 	*hpack_decode(unsigned char *, size_t, struct hpack_table *);
+int	 hpack_decode_cb(unsigned char *, size_t, struct hpack_table *,
+	    int (*)(struct hpack_header *, void *), void *);
+int	 hpack_decode_fragment(unsigned char *, size_t, int,
+	    struct hpack_table *, int (*)(struct hpack_header *, void *),
+	    void *);
 unsigned char
 	*hpack_encode(struct hpack_headerblock *, size_t *,
 	    struct hpack_table *);
+size_t	 hpack_encode_maxlen(struct hpack_headerblock *,
+	    struct hpack_table *);
+ssize_t	 hpack_encode_into(struct hpack_headerblock *, unsigned char *,
+	    size_t, struct hpack_table *);
+ssize_t	 hpack_encode_iov(struct hpack_headerblock *, struct iovec *,
+	    int, struct hpack_table *);
 
 struct hpack_header
 	*hpack_header_new(void);
@@ -65,6 +153,11 @@ unsigned char
 char	*hpack_huffman_decode_str(unsigned char *, size_t);
 unsigned char
 	*hpack_huffman_encode(unsigned char *, size_t, size_t *);
+size_t	 hpack_huffman_encoded_len(const unsigned char *, size_t);
+ssize_t	 hpack_huffman_decode_into(const unsigned char *, size_t,
+	    unsigned char *, size_t);
+ssize_t	 hpack_huffman_encode_into(const unsigned char *, size_t,
+	    unsigned char *, size_t);
 
 #ifdef HPACK_INTERNAL
 
@@ -76,30 +169,140 @@ unsigned char
 
 /* from sys/param.h */
 #define MAX(a,b)		(((a)>(b))?(a):(b))
+#define MIN(a,b)		(((a)<(b))?(a):(b))
 
 #define HPACK_HUFFMAN_BUFSZ	256
+#define HPACK_ARENA_CHUNKSZ	4096
+#define HPACK_ARENA_ALIGN	sizeof(void *)
 #define HPACK_MAX_TABLE_SIZE	4096
 
+/*
+ * Flat Huffman tree of the 256 internal nodes, the root is node 0.
+ * The two branches either point to the index of the next node or
+ * to a leaf with the symbol.
+ */
+#define HPACK_HUFFMAN_F_LEAF	0x8000
+
 struct hpack_huffman_node {
-	struct hpack_huffman_node	*hpn_zero;
-	struct hpack_huffman_node	*hpn_one;
-	int				 hpn_sym;
+	unsigned short			 hpn_child[2];	/* zero, one */
 };
 
-struct hpack {
-	struct hpack_huffman_node	*hpack_huffman;
+/*
+ * Huffman decoding state machine.  Each state is an internal node of
+ * the Huffman tree and each transition consumes 4 bits of input.
+ */
+#define HPACK_HUFFMAN_STATES	256
+#define HPACK_HUFFMAN_F_EMIT	0x01	/* emits a symbol */
+#define HPACK_HUFFMAN_F_ACCEPT	0x02	/* valid end of input (EOS padding) */
+#define HPACK_HUFFMAN_F_FAIL	0x04	/* invalid code (EOS) */
+
+struct hpack_huffman_state {
+	unsigned char			 hps_state;	/* next state */
+	unsigned char			 hps_flags;	/* state flags */
+	unsigned char			 hps_sym;	/* emitted symbol */
+	unsigned char			 hps_bits;	/* bits until symbol */
 };
 
+/*
+ * Huffman decoding lookup table for the next 12 bits of input.  Most
+ * symbols have codes of 5 to 8 bits, so each entry decodes up to two
+ * symbols.  Entries without a symbol are the prefix of a longer code
+ * and store the decoding state after 12 bits in the first symbol.
+ */
+#define HPACK_HUFFMAN_FAST_BITS	12
+
+struct hpack_huffman_fast {
+	unsigned char			 hpf_sym[2];	/* decoded symbols */
+	unsigned char			 hpf_bits[2];	/* bits until symbol */
+};
+
+/*
+ * The dynamic table is a ring of entries that is allocated as a single
+ * block with the hash buckets for the maximum table size.  Each entry
+ * takes at least 32 octets, so the number of slots is a power of two of
+ * at least max_table_size/32.  The entries are also hashed by name and
+ * by name and value for the encoder; both hash tables use the same
+ * number of buckets.
+ *
+ * The name and value of an entry are reference-counted strings that
+ * are the only copy: a decoded header that is added to the table passes
+ * its strings to the entry, and decoded headers that refer to the entry
+ * take another reference, so they stay valid after it was evicted.
+ * Only strings that are not shared yet, such as the caller strings of
+ * the encoder, are allocated when the entry is added and freed when the
+ * last reference is gone; there is no separate ring of string bytes.
+ */
+#define HPACK_TABLE_SLOTS	16	/* minimum number of slots */
+
+struct hpack_entry {
+	char				*hte_name;	/* shared string */
+	char				*hte_value;	/* shared string */
+	size_t				 hte_namelen;
+	size_t				 hte_valuelen;
+	unsigned long			 hte_seq;	/* insertion number */
+	unsigned int			 hte_namehash;
+	unsigned int			 hte_fieldhash;	/* name and value */
+	enum hpack_header_token		 hte_token;
+	unsigned char			 hte_namecls;	/* HPACK_C_* */
+	unsigned char			 hte_valuecls;
+	LIST_ENTRY(hpack_entry)		 hte_name_entry;
+	LIST_ENTRY(hpack_entry)		 hte_field_entry;
+};
+LIST_HEAD(hpack_bucket, hpack_entry);
+
 struct hpack_table {
-	struct hpack_headerblock	*htb_dynamic;
+	struct hpack_entry		*htb_dynamic;	/* ring of entries */
+	size_t				 htb_dynamic_slots;
+	size_t				 htb_dynamic_first; /* oldest entry */
+	unsigned long			 htb_dynamic_seq; /* next insertion */
+	struct hpack_bucket		*htb_names;
+	struct hpack_bucket		*htb_fields;
 	long				 htb_dynamic_size;
 	long				 htb_dynamic_entries;
 
 	long				 htb_table_size;
 	long				 htb_max_table_size;
+	unsigned int			 htb_flags;
 
 	struct hpack_headerblock	*htb_headers;
 	struct hpack_header		*htb_next;
+	int				(*htb_cb)(struct hpack_header *,
+					    void *);
+	void				*htb_cbarg;
+	struct hbuf			*htb_pending;	/* split field */
+	size_t				 htb_pending_need;
+	size_t				 htb_skip;	/* of dropped field */
+	int				 htb_skipvalue;
+	struct hpack_arena		*htb_hdrarena;	/* decoded headers */
+	size_t				 htb_max_list_size;
+	size_t				 htb_list_size;
+	int				 htb_list_full;
+	int				 htb_error;	/* invalid field */
+	int				 htb_regular;	/* no pseudo-header */
+	unsigned char			 htb_namecls;	/* of htb_next */
+	unsigned char			 htb_valuecls;
+};
+
+/* Owned header strings are const but have to be freed */
+#define HPACK_UNCONST(_p)	((void *)(uintptr_t)(const void *)(_p))
+
+/* Immutable reference-counted strings shared by headers and the table */
+struct hpack_string {
+	unsigned int			 hs_refs;
+	char				 hs_data[1];
+};
+
+/* Bump allocator for decoded header blocks */
+struct hpack_chunk {
+	SLIST_ENTRY(hpack_chunk)	 hch_entry;
+	size_t				 hch_size;
+	size_t				 hch_used;
+	unsigned char			 hch_data[1];
+};
+
+struct hpack_arena {
+	SLIST_HEAD(, hpack_chunk)	 har_chunks;	/* newest first */
+	size_t				 har_size;	/* chunk size */
 };
 
 /* Simple internal buffer API */
@@ -109,6 +312,7 @@ struct hbuf {
 	size_t			 rpos;		/* read position */
 	size_t			 wpos;		/* write position */
 	size_t			 wbsz;		/* realloc buf size */
+	int			 eof;		/* read past the end */
 };
 
 /* Masks, flags, and prefixes of the field types */
@@ -126,6 +330,104 @@ struct hbuf {
 #define HPACK_F_LITERAL			0x00	/* literal encoding */
 #define HPACK_F_LITERAL_HUFFMAN		0x80	/* huffman encoding */
 
+/* Field type, prefix mask, and index of every first octet */
+enum hpack_octet_type {
+	HPACK_T_INDEX,
+	HPACK_T_LITERAL,
+	HPACK_T_TABLE_SIZE_UPDATE
+};
+
+/* Result of scanning a field that is split between fragments */
+enum hpack_scan {
+	HPACK_S_COMPLETE,
+	HPACK_S_PARTIAL,
+	HPACK_S_DROP
+};
+
+struct hpack_octet {
+	unsigned char		 ho_type;
+	unsigned char		 ho_mask;
+	unsigned char		 ho_index;
+};
+
+#define HPACK_OCTET16(_t, _m, _i)					\
+	{ _t, _m, _i }, { _t, _m, _i }, { _t, _m, _i }, { _t, _m, _i },	\
+	{ _t, _m, _i }, { _t, _m, _i }, { _t, _m, _i }, { _t, _m, _i },	\
+	{ _t, _m, _i }, { _t, _m, _i }, { _t, _m, _i }, { _t, _m, _i },	\
+	{ _t, _m, _i }, { _t, _m, _i }, { _t, _m, _i }, { _t, _m, _i }
+
+static const struct hpack_octet hpack_octets[256] = {
+	/* 0x00-0x0f: 6.2.2 Literal Header Field without Indexing */
+	HPACK_OCTET16(HPACK_T_LITERAL,
+	    HPACK_M_LITERAL_NO_INDEX, HPACK_NO_INDEX),
+	/* 0x10-0x1f: 6.2.3 Literal Header Field Never Indexed */
+	HPACK_OCTET16(HPACK_T_LITERAL,
+	    HPACK_M_LITERAL_NEVER_INDEX, HPACK_NEVER_INDEX),
+	/* 0x20-0x3f: 6.3 Dynamic Table Size Update */
+	HPACK_OCTET16(HPACK_T_TABLE_SIZE_UPDATE,
+	    HPACK_M_TABLE_SIZE_UPDATE, HPACK_NO_INDEX),
+	HPACK_OCTET16(HPACK_T_TABLE_SIZE_UPDATE,
+	    HPACK_M_TABLE_SIZE_UPDATE, HPACK_NO_INDEX),
+	/* 0x40-0x7f: 6.2.1 Literal Header Field with Incremental Indexing */
+	HPACK_OCTET16(HPACK_T_LITERAL, HPACK_M_LITERAL_INDEX, HPACK_INDEX),
+	HPACK_OCTET16(HPACK_T_LITERAL, HPACK_M_LITERAL_INDEX, HPACK_INDEX),
+	HPACK_OCTET16(HPACK_T_LITERAL, HPACK_M_LITERAL_INDEX, HPACK_INDEX),
+	HPACK_OCTET16(HPACK_T_LITERAL, HPACK_M_LITERAL_INDEX, HPACK_INDEX),
+	/* 0x80-0xff: 6.1 Indexed Header Field Representation */
+	HPACK_OCTET16(HPACK_T_INDEX, HPACK_M_INDEX, HPACK_NO_INDEX),
+	HPACK_OCTET16(HPACK_T_INDEX, HPACK_M_INDEX, HPACK_NO_INDEX),
+	HPACK_OCTET16(HPACK_T_INDEX, HPACK_M_INDEX, HPACK_NO_INDEX),
+	HPACK_OCTET16(HPACK_T_INDEX, HPACK_M_INDEX, HPACK_NO_INDEX),
+	HPACK_OCTET16(HPACK_T_INDEX, HPACK_M_INDEX, HPACK_NO_INDEX),
+	HPACK_OCTET16(HPACK_T_INDEX, HPACK_M_INDEX, HPACK_NO_INDEX),
+	HPACK_OCTET16(HPACK_T_INDEX, HPACK_M_INDEX, HPACK_NO_INDEX),
+	HPACK_OCTET16(HPACK_T_INDEX, HPACK_M_INDEX, HPACK_NO_INDEX)
+};
+
+/*
+ * Character classes to validate HTTP/2 field names and values
+ * (RFC 9113 section 8.2.1).  The classes of all characters of a string
+ * are combined while it is decoded.
+ */
+#define HPACK_C_NUL			0x01	/* NUL character */
+#define HPACK_C_CRLF			0x02	/* CR or LF */
+#define HPACK_C_CTL			0x04	/* other CTL, SP, or non-ASCII */
+#define HPACK_C_UPPER			0x08	/* uppercase character */
+#define HPACK_C_COLON			0x10	/* colon of pseudo-headers */
+#define HPACK_C_NAME							\
+	(HPACK_C_NUL|HPACK_C_CRLF|HPACK_C_CTL|HPACK_C_UPPER)
+#define HPACK_C_VALUE			(HPACK_C_NUL|HPACK_C_CRLF)
+#define HPACK_C_ISWS(_c)		((_c) == ' ' || (_c) == '\t')
+
+#define N	HPACK_C_NUL
+#define R	HPACK_C_CRLF
+#define C	HPACK_C_CTL
+#define U	HPACK_C_UPPER
+#define S	HPACK_C_COLON
+static const unsigned char hpack_chars[256] = {
+	/* 0x00 */ N, C, C, C, C, C, C, C, C, C, R, C, C, R, C, C,
+	/* 0x10 */ C, C, C, C, C, C, C, C, C, C, C, C, C, C, C, C,
+	/* 0x20 */ C, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* 0x30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, S, 0, 0, 0, 0, 0,
+	/* 0x40 */ 0, U, U, U, U, U, U, U, U, U, U, U, U, U, U, U,
+	/* 0x50 */ U, U, U, U, U, U, U, U, U, U, U, 0, 0, 0, 0, 0,
+	/* 0x60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* 0x70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, C,
+	/* 0x80 */ C, C, C, C, C, C, C, C, C, C, C, C, C, C, C, C,
+	/* 0x90 */ C, C, C, C, C, C, C, C, C, C, C, C, C, C, C, C,
+	/* 0xa0 */ C, C, C, C, C, C, C, C, C, C, C, C, C, C, C, C,
+	/* 0xb0 */ C, C, C, C, C, C, C, C, C, C, C, C, C, C, C, C,
+	/* 0xc0 */ C, C, C, C, C, C, C, C, C, C, C, C, C, C, C, C,
+	/* 0xd0 */ C, C, C, C, C, C, C, C, C, C, C, C, C, C, C, C,
+	/* 0xe0 */ C, C, C, C, C, C, C, C, C, C, C, C, C, C, C, C,
+	/* 0xf0 */ C, C, C, C, C, C, C, C, C, C, C, C, C, C, C, C
+};
+#undef N
+#undef R
+#undef C
+#undef U
+#undef S
+
 /*
  * Appendix A.  Static Table Definition
  */
@@ -133,8 +435,36 @@ struct hpack_index {
 	long			 hpi_id;	/* Index */
 	const char		*hpi_name;	/* Header Name */
 	const char		*hpi_value;	/* Value */
+	size_t			 hpi_namelen;
+	size_t			 hpi_valuelen;
+	struct hpack_entry	*hpi_entry;	/* dynamic table entry */
 };
 #define HPACK_STATIC_SIZE (sizeof(static_table) / sizeof(static_table[0]))
+
+/*
+ * The static table names are found with a perfect hash of the name
+ * length and its first and last character that is generated into
+ * hpack_static.h.  All names are lowercase and only contain characters
+ * that have the 0x20 bit set, so setting it ignores the case.
+ */
+#define HPACK_STATIC_HASH_MAX	256
+#define HPACK_STATIC_HASH(_n, _l)					\
+	(((_l) + ((_n)[0] | 0x20) * HPACK_STATIC_HASH_A +		\
+	((_n)[(_l) - 1] | 0x20) * HPACK_STATIC_HASH_B) &		\
+	(HPACK_STATIC_HASH_SIZE - 1))
+
+struct hpack_static_name {
+	unsigned char			 hsn_id;	/* first index */
+	unsigned char			 hsn_count;	/* entries */
+	unsigned char			 hsn_namelen;
+};
+
+struct hpack_static_length {
+	unsigned char			 hsl_namelen;
+	unsigned char			 hsl_valuelen;
+	unsigned char			 hsl_token;	/* first index */
+};
+
 static struct hpack_index static_table[] = {
 	{ 1,	":authority",			NULL },			\
 	{ 2,	":method",			"GET" },		\
@@ -0,0 +1,3247 @@
+/*
+ * THIS FILE IS AUTOMATICALLY GENERATED BY gen/hpackgen.c - DO NOT EDIT.
+ *
+ * Huffman decoding tables of the HPACK Huffman code in hpack.h,
+ * regenerate them with "make tables" in gen/.
+ */
+
+#ifndef HPACK_HUFFMAN_H
+#define HPACK_HUFFMAN_H
+
+#ifdef HPACK_HUFFMAN_TREE
+static const struct hpack_huffman_node
+    huffman_decode_tree[HPACK_HUFFMAN_STATES] = {
+	{{0x0001,0x0016}}, {{0x0002,0x0009}}, {{0x0003,0x0006}}, {{0x0004,0x0005}},
+	{{0x8030,0x8031}}, {{0x8032,0x8061}}, {{0x0007,0x0008}}, {{0x8063,0x8065}},
+	{{0x8069,0x806f}}, {{0x000a,0x000f}}, {{0x000b,0x000c}}, {{0x8073,0x8074}},
+	{{0x000d,0x000e}}, {{0x8020,0x8025}}, {{0x802d,0x802e}}, {{0x0010,0x0013}},
+	{{0x0011,0x0012}}, {{0x802f,0x8033}}, {{0x8034,0x8035}}, {{0x0014,0x0015}},
+	{{0x8036,0x8037}}, {{0x8038,0x8039}}, {{0x0017,0x0028}}, {{0x0018,0x001f}},
+	{{0x0019,0x001c}}, {{0x001a,0x001b}}, {{0x803d,0x8041}}, {{0x805f,0x8062}},
+	{{0x001d,0x001e}}, {{0x8064,0x8066}}, {{0x8067,0x8068}}, {{0x0020,0x0023}},
+	{{0x0021,0x0022}}, {{0x806c,0x806d}}, {{0x806e,0x8070}}, {{0x0024,0x0025}},
+	{{0x8072,0x8075}}, {{0x0026,0x0027}}, {{0x803a,0x8042}}, {{0x8043,0x8044}},
+	{{0x0029,0x0038}}, {{0x002a,0x0031}}, {{0x002b,0x002e}}, {{0x002c,0x002d}},
+	{{0x8045,0x8046}}, {{0x8047,0x8048}}, {{0x002f,0x0030}}, {{0x8049,0x804a}},
+	{{0x804b,0x804c}}, {{0x0032,0x0035}}, {{0x0033,0x0034}}, {{0x804d,0x804e}},
+	{{0x804f,0x8050}}, {{0x0036,0x0037}}, {{0x8051,0x8052}}, {{0x8053,0x8054}},
+	{{0x0039,0x0040}}, {{0x003a,0x003d}}, {{0x003b,0x003c}}, {{0x8055,0x8056}},
+	{{0x8057,0x8059}}, {{0x003e,0x003f}}, {{0x806a,0x806b}}, {{0x8071,0x8076}},
+	{{0x0041,0x0044}}, {{0x0042,0x0043}}, {{0x8077,0x8078}}, {{0x8079,0x807a}},
+	{{0x0045,0x0048}}, {{0x0046,0x0047}}, {{0x8026,0x802a}}, {{0x802c,0x803b}},
+	{{0x0049,0x004a}}, {{0x8058,0x805a}}, {{0x004b,0x004e}}, {{0x004c,0x004d}},
+	{{0x8021,0x8022}}, {{0x8028,0x8029}}, {{0x004f,0x0051}}, {{0x803f,0x0050}},
+	{{0x8027,0x802b}}, {{0x0052,0x0054}}, {{0x807c,0x0053}}, {{0x8023,0x803e}},
+	{{0x0055,0x0058}}, {{0x0056,0x0057}}, {{0x8000,0x8024}}, {{0x8040,0x805b}},
+	{{0x0059,0x005a}}, {{0x805d,0x807e}}, {{0x005b,0x005c}}, {{0x805e,0x807d}},
+	{{0x005d,0x005e}}, {{0x803c,0x8060}}, {{0x807b,0x005f}}, {{0x0060,0x006e}},
+	{{0x0061,0x0065}}, {{0x0062,0x0063}}, {{0x805c,0x80c3}}, {{0x80d0,0x0064}},
+	{{0x8080,0x8082}}, {{0x0066,0x0069}}, {{0x0067,0x0068}}, {{0x8083,0x80a2}},
+	{{0x80b8,0x80c2}}, {{0x006a,0x006b}}, {{0x80e0,0x80e2}}, {{0x006c,0x006d}},
+	{{0x8099,0x80a1}}, {{0x80a7,0x80ac}}, {{0x006f,0x0085}}, {{0x0070,0x0077}},
+	{{0x0071,0x0074}}, {{0x0072,0x0073}}, {{0x80b0,0x80b1}}, {{0x80b3,0x80d1}},
+	{{0x0075,0x0076}}, {{0x80d8,0x80d9}}, {{0x80e3,0x80e5}}, {{0x0078,0x007e}},
+	{{0x0079,0x007b}}, {{0x80e6,0x007a}}, {{0x8081,0x8084}}, {{0x007c,0x007d}},
+	{{0x8085,0x8086}}, {{0x8088,0x8092}}, {{0x007f,0x0082}}, {{0x0080,0x0081}},
+	{{0x809a,0x809c}}, {{0x80a0,0x80a3}}, {{0x0083,0x0084}}, {{0x80a4,0x80a9}},
+	{{0x80aa,0x80ad}}, {{0x0086,0x0099}}, {{0x0087,0x008e}}, {{0x0088,0x008b}},
+	{{0x0089,0x008a}}, {{0x80b2,0x80b5}}, {{0x80b9,0x80ba}}, {{0x008c,0x008d}},
+	{{0x80bb,0x80bd}}, {{0x80be,0x80c4}}, {{0x008f,0x0092}}, {{0x0090,0x0091}},
+	{{0x80c6,0x80e4}}, {{0x80e8,0x80e9}}, {{0x0093,0x0096}}, {{0x0094,0x0095}},
+	{{0x8001,0x8087}}, {{0x8089,0x808a}}, {{0x0097,0x0098}}, {{0x808b,0x808c}},
+	{{0x808d,0x808f}}, {{0x009a,0x00a9}}, {{0x009b,0x00a2}}, {{0x009c,0x009f}},
+	{{0x009d,0x009e}}, {{0x8093,0x8095}}, {{0x8096,0x8097}}, {{0x00a0,0x00a1}},
+	{{0x8098,0x809b}}, {{0x809d,0x809e}}, {{0x00a3,0x00a6}}, {{0x00a4,0x00a5}},
+	{{0x80a5,0x80a6}}, {{0x80a8,0x80ae}}, {{0x00a7,0x00a8}}, {{0x80af,0x80b4}},
+	{{0x80b6,0x80b7}}, {{0x00aa,0x00b4}}, {{0x00ab,0x00ae}}, {{0x00ac,0x00ad}},
+	{{0x80bc,0x80bf}}, {{0x80c5,0x80e7}}, {{0x00af,0x00b1}}, {{0x80ef,0x00b0}},
+	{{0x8009,0x808e}}, {{0x00b2,0x00b3}}, {{0x8090,0x8091}}, {{0x8094,0x809f}},
+	{{0x00b5,0x00be}}, {{0x00b6,0x00b9}}, {{0x00b7,0x00b8}}, {{0x80ab,0x80ce}},
+	{{0x80d7,0x80e1}}, {{0x00ba,0x00bb}}, {{0x80ec,0x80ed}}, {{0x00bc,0x00bd}},
+	{{0x80c7,0x80cf}}, {{0x80ea,0x80eb}}, {{0x00bf,0x00cf}}, {{0x00c0,0x00c7}},
+	{{0x00c1,0x00c4}}, {{0x00c2,0x00c3}}, {{0x80c0,0x80c1}}, {{0x80c8,0x80c9}},
+	{{0x00c5,0x00c6}}, {{0x80ca,0x80cd}}, {{0x80d2,0x80d5}}, {{0x00c8,0x00cb}},
+	{{0x00c9,0x00ca}}, {{0x80da,0x80db}}, {{0x80ee,0x80f0}}, {{0x00cc,0x00cd}},
+	{{0x80f2,0x80f3}}, {{0x80ff,0x00ce}}, {{0x80cb,0x80cc}}, {{0x00d0,0x00df}},
+	{{0x00d1,0x00d8}}, {{0x00d2,0x00d5}}, {{0x00d3,0x00d4}}, {{0x80d3,0x80d4}},
+	{{0x80d6,0x80dd}}, {{0x00d6,0x00d7}}, {{0x80de,0x80df}}, {{0x80f1,0x80f4}},
+	{{0x00d9,0x00dc}}, {{0x00da,0x00db}}, {{0x80f5,0x80f6}}, {{0x80f7,0x80f8}},
+	{{0x00dd,0x00de}}, {{0x80fa,0x80fb}}, {{0x80fc,0x80fd}}, {{0x00e0,0x00ee}},
+	{{0x00e1,0x00e7}}, {{0x00e2,0x00e4}}, {{0x80fe,0x00e3}}, {{0x8002,0x8003}},
+	{{0x00e5,0x00e6}}, {{0x8004,0x8005}}, {{0x8006,0x8007}}, {{0x00e8,0x00eb}},
+	{{0x00e9,0x00ea}}, {{0x8008,0x800b}}, {{0x800c,0x800e}}, {{0x00ec,0x00ed}},
+	{{0x800f,0x8010}}, {{0x8011,0x8012}}, {{0x00ef,0x00f6}}, {{0x00f0,0x00f3}},
+	{{0x00f1,0x00f2}}, {{0x8013,0x8014}}, {{0x8015,0x8017}}, {{0x00f4,0x00f5}},
+	{{0x8018,0x8019}}, {{0x801a,0x801b}}, {{0x00f7,0x00fa}}, {{0x00f8,0x00f9}},
+	{{0x801c,0x801d}}, {{0x801e,0x801f}}, {{0x00fb,0x00fc}}, {{0x807f,0x80dc}},
+	{{0x80f9,0x00fd}}, {{0x00fe,0x00ff}}, {{0x800a,0x800d}}, {{0x8016,0x8100}},
+};
+#else
+static const struct hpack_huffman_state
+    huffman_decode_states[HPACK_HUFFMAN_STATES][16] = {
+	/* state 0 */
+	{
+	    {  4,0x0,  0,0}, {  5,0x0,  0,0}, {  7,0x0,  0,0}, {  8,0x0,  0,0},
+	    { 11,0x0,  0,0}, { 12,0x0,  0,0}, { 16,0x0,  0,0}, { 19,0x0,  0,0},
+	    { 25,0x0,  0,0}, { 28,0x0,  0,0}, { 32,0x0,  0,0}, { 35,0x0,  0,0},
+	    { 42,0x0,  0,0}, { 49,0x0,  0,0}, { 57,0x0,  0,0}, { 64,0x2,  0,0},
+	},
+	/* state 1 */
+	{
+	    {  0,0x3, 48,4}, {  0,0x3, 49,4}, {  0,0x3, 50,4}, {  0,0x3, 97,4},
+	    {  0,0x3, 99,4}, {  0,0x3,101,4}, {  0,0x3,105,4}, {  0,0x3,111,4},
+	    {  0,0x3,115,4}, {  0,0x3,116,4}, { 13,0x0,  0,0}, { 14,0x0,  0,0},
+	    { 17,0x0,  0,0}, { 18,0x0,  0,0}, { 20,0x0,  0,0}, { 21,0x0,  0,0},
+	},
+	/* state 2 */
+	{
+	    {  1,0x1, 48,3}, { 22,0x3, 48,3}, {  1,0x1, 49,3}, { 22,0x3, 49,3},
+	    {  1,0x1, 50,3}, { 22,0x3, 50,3}, {  1,0x1, 97,3}, { 22,0x3, 97,3},
+	    {  1,0x1, 99,3}, { 22,0x3, 99,3}, {  1,0x1,101,3}, { 22,0x3,101,3},
+	    {  1,0x1,105,3}, { 22,0x3,105,3}, {  1,0x1,111,3}, { 22,0x3,111,3},
+	},
+	/* state 3 */
+	{
+	    {  2,0x1, 48,2}, {  9,0x1, 48,2}, { 23,0x1, 48,2}, { 40,0x3, 48,2},
+	    {  2,0x1, 49,2}, {  9,0x1, 49,2}, { 23,0x1, 49,2}, { 40,0x3, 49,2},
+	    {  2,0x1, 50,2}, {  9,0x1, 50,2}, { 23,0x1, 50,2}, { 40,0x3, 50,2},
+	    {  2,0x1, 97,2}, {  9,0x1, 97,2}, { 23,0x1, 97,2}, { 40,0x3, 97,2},
+	},
+	/* state 4 */
+	{
+	    {  3,0x1, 48,1}, {  6,0x1, 48,1}, { 10,0x1, 48,1}, { 15,0x1, 48,1},
+	    { 24,0x1, 48,1}, { 31,0x1, 48,1}, { 41,0x1, 48,1}, { 56,0x3, 48,1},
+	    {  3,0x1, 49,1}, {  6,0x1, 49,1}, { 10,0x1, 49,1}, { 15,0x1, 49,1},
+	    { 24,0x1, 49,1}, { 31,0x1, 49,1}, { 41,0x1, 49,1}, { 56,0x3, 49,1},
+	},
+	/* state 5 */
+	{
+	    {  3,0x1, 50,1}, {  6,0x1, 50,1}, { 10,0x1, 50,1}, { 15,0x1, 50,1},
+	    { 24,0x1, 50,1}, { 31,0x1, 50,1}, { 41,0x1, 50,1}, { 56,0x3, 50,1},
+	    {  3,0x1, 97,1}, {  6,0x1, 97,1}, { 10,0x1, 97,1}, { 15,0x1, 97,1},
+	    { 24,0x1, 97,1}, { 31,0x1, 97,1}, { 41,0x1, 97,1}, { 56,0x3, 97,1},
+	},
+	/* state 6 */
+	{
+	    {  2,0x1, 99,2}, {  9,0x1, 99,2}, { 23,0x1, 99,2}, { 40,0x3, 99,2},
+	    {  2,0x1,101,2}, {  9,0x1,101,2}, { 23,0x1,101,2}, { 40,0x3,101,2},
+	    {  2,0x1,105,2}, {  9,0x1,105,2}, { 23,0x1,105,2}, { 40,0x3,105,2},
+	    {  2,0x1,111,2}, {  9,0x1,111,2}, { 23,0x1,111,2}, { 40,0x3,111,2},
+	},
+	/* state 7 */
+	{
+	    {  3,0x1, 99,1}, {  6,0x1, 99,1}, { 10,0x1, 99,1}, { 15,0x1, 99,1},
+	    { 24,0x1, 99,1}, { 31,0x1, 99,1}, { 41,0x1, 99,1}, { 56,0x3, 99,1},
+	    {  3,0x1,101,1}, {  6,0x1,101,1}, { 10,0x1,101,1}, { 15,0x1,101,1},
+	    { 24,0x1,101,1}, { 31,0x1,101,1}, { 41,0x1,101,1}, { 56,0x3,101,1},
+	},
+	/* state 8 */
+	{
+	    {  3,0x1,105,1}, {  6,0x1,105,1}, { 10,0x1,105,1}, { 15,0x1,105,1},
+	    { 24,0x1,105,1}, { 31,0x1,105,1}, { 41,0x1,105,1}, { 56,0x3,105,1},
+	    {  3,0x1,111,1}, {  6,0x1,111,1}, { 10,0x1,111,1}, { 15,0x1,111,1},
+	    { 24,0x1,111,1}, { 31,0x1,111,1}, { 41,0x1,111,1}, { 56,0x3,111,1},
+	},
+	/* state 9 */
+	{
+	    {  1,0x1,115,3}, { 22,0x3,115,3}, {  1,0x1,116,3}, { 22,0x3,116,3},
+	    {  0,0x3, 32,4}, {  0,0x3, 37,4}, {  0,0x3, 45,4}, {  0,0x3, 46,4},
+	    {  0,0x3, 47,4}, {  0,0x3, 51,4}, {  0,0x3, 52,4}, {  0,0x3, 53,4},
+	    {  0,0x3, 54,4}, {  0,0x3, 55,4}, {  0,0x3, 56,4}, {  0,0x3, 57,4},
+	},
+	/* state 10 */
+	{
+	    {  2,0x1,115,2}, {  9,0x1,115,2}, { 23,0x1,115,2}, { 40,0x3,115,2},
+	    {  2,0x1,116,2}, {  9,0x1,116,2}, { 23,0x1,116,2}, { 40,0x3,116,2},
+	    {  1,0x1, 32,3}, { 22,0x3, 32,3}, {  1,0x1, 37,3}, { 22,0x3, 37,3},
+	    {  1,0x1, 45,3}, { 22,0x3, 45,3}, {  1,0x1, 46,3}, { 22,0x3, 46,3},
+	},
+	/* state 11 */
+	{
+	    {  3,0x1,115,1}, {  6,0x1,115,1}, { 10,0x1,115,1}, { 15,0x1,115,1},
+	    { 24,0x1,115,1}, { 31,0x1,115,1}, { 41,0x1,115,1}, { 56,0x3,115,1},
+	    {  3,0x1,116,1}, {  6,0x1,116,1}, { 10,0x1,116,1}, { 15,0x1,116,1},
+	    { 24,0x1,116,1}, { 31,0x1,116,1}, { 41,0x1,116,1}, { 56,0x3,116,1},
+	},
+	/* state 12 */
+	{
+	    {  2,0x1, 32,2}, {  9,0x1, 32,2}, { 23,0x1, 32,2}, { 40,0x3, 32,2},
+	    {  2,0x1, 37,2}, {  9,0x1, 37,2}, { 23,0x1, 37,2}, { 40,0x3, 37,2},
+	    {  2,0x1, 45,2}, {  9,0x1, 45,2}, { 23,0x1, 45,2}, { 40,0x3, 45,2},
+	    {  2,0x1, 46,2}, {  9,0x1, 46,2}, { 23,0x1, 46,2}, { 40,0x3, 46,2},
+	},
+	/* state 13 */
+	{
+	    {  3,0x1, 32,1}, {  6,0x1, 32,1}, { 10,0x1, 32,1}, { 15,0x1, 32,1},
+	    { 24,0x1, 32,1}, { 31,0x1, 32,1}, { 41,0x1, 32,1}, { 56,0x3, 32,1},
+	    {  3,0x1, 37,1}, {  6,0x1, 37,1}, { 10,0x1, 37,1}, { 15,0x1, 37,1},
+	    { 24,0x1, 37,1}, { 31,0x1, 37,1}, { 41,0x1, 37,1}, { 56,0x3, 37,1},
+	},
+	/* state 14 */
+	{
+	    {  3,0x1, 45,1}, {  6,0x1, 45,1}, { 10,0x1, 45,1}, { 15,0x1, 45,1},
+	    { 24,0x1, 45,1}, { 31,0x1, 45,1}, { 41,0x1, 45,1}, { 56,0x3, 45,1},
+	    {  3,0x1, 46,1}, {  6,0x1, 46,1}, { 10,0x1, 46,1}, { 15,0x1, 46,1},
+	    { 24,0x1, 46,1}, { 31,0x1, 46,1}, { 41,0x1, 46,1}, { 56,0x3, 46,1},
+	},
+	/* state 15 */
+	{
+	    {  1,0x1, 47,3}, { 22,0x3, 47,3}, {  1,0x1, 51,3}, { 22,0x3, 51,3},
+	    {  1,0x1, 52,3}, { 22,0x3, 52,3}, {  1,0x1, 53,3}, { 22,0x3, 53,3},
+	    {  1,0x1, 54,3}, { 22,0x3, 54,3}, {  1,0x1, 55,3}, { 22,0x3, 55,3},
+	    {  1,0x1, 56,3}, { 22,0x3, 56,3}, {  1,0x1, 57,3}, { 22,0x3, 57,3},
+	},
+	/* state 16 */
+	{
+	    {  2,0x1, 47,2}, {  9,0x1, 47,2}, { 23,0x1, 47,2}, { 40,0x3, 47,2},
+	    {  2,0x1, 51,2}, {  9,0x1, 51,2}, { 23,0x1, 51,2}, { 40,0x3, 51,2},
+	    {  2,0x1, 52,2}, {  9,0x1, 52,2}, { 23,0x1, 52,2}, { 40,0x3, 52,2},
+	    {  2,0x1, 53,2}, {  9,0x1, 53,2}, { 23,0x1, 53,2}, { 40,0x3, 53,2},
+	},
+	/* state 17 */
+	{
+	    {  3,0x1, 47,1}, {  6,0x1, 47,1}, { 10,0x1, 47,1}, { 15,0x1, 47,1},
+	    { 24,0x1, 47,1}, { 31,0x1, 47,1}, { 41,0x1, 47,1}, { 56,0x3, 47,1},
+	    {  3,0x1, 51,1}, {  6,0x1, 51,1}, { 10,0x1, 51,1}, { 15,0x1, 51,1},
+	    { 24,0x1, 51,1}, { 31,0x1, 51,1}, { 41,0x1, 51,1}, { 56,0x3, 51,1},
+	},
+	/* state 18 */
+	{
+	    {  3,0x1, 52,1}, {  6,0x1, 52,1}, { 10,0x1, 52,1}, { 15,0x1, 52,1},
+	    { 24,0x1, 52,1}, { 31,0x1, 52,1}, { 41,0x1, 52,1}, { 56,0x3, 52,1},
+	    {  3,0x1, 53,1}, {  6,0x1, 53,1}, { 10,0x1, 53,1}, { 15,0x1, 53,1},
+	    { 24,0x1, 53,1}, { 31,0x1, 53,1}, { 41,0x1, 53,1}, { 56,0x3, 53,1},
+	},
+	/* state 19 */
+	{
+	    {  2,0x1, 54,2}, {  9,0x1, 54,2}, { 23,0x1, 54,2}, { 40,0x3, 54,2},
+	    {  2,0x1, 55,2}, {  9,0x1, 55,2}, { 23,0x1, 55,2}, { 40,0x3, 55,2},
+	    {  2,0x1, 56,2}, {  9,0x1, 56,2}, { 23,0x1, 56,2}, { 40,0x3, 56,2},
+	    {  2,0x1, 57,2}, {  9,0x1, 57,2}, { 23,0x1, 57,2}, { 40,0x3, 57,2},
+	},
+	/* state 20 */
+	{
+	    {  3,0x1, 54,1}, {  6,0x1, 54,1}, { 10,0x1, 54,1}, { 15,0x1, 54,1},
+	    { 24,0x1, 54,1}, { 31,0x1, 54,1}, { 41,0x1, 54,1}, { 56,0x3, 54,1},
+	    {  3,0x1, 55,1}, {  6,0x1, 55,1}, { 10,0x1, 55,1}, { 15,0x1, 55,1},
+	    { 24,0x1, 55,1}, { 31,0x1, 55,1}, { 41,0x1, 55,1}, { 56,0x3, 55,1},
+	},
+	/* state 21 */
+	{
+	    {  3,0x1, 56,1}, {  6,0x1, 56,1}, { 10,0x1, 56,1}, { 15,0x1, 56,1},
+	    { 24,0x1, 56,1}, { 31,0x1, 56,1}, { 41,0x1, 56,1}, { 56,0x3, 56,1},
+	    {  3,0x1, 57,1}, {  6,0x1, 57,1}, { 10,0x1, 57,1}, { 15,0x1, 57,1},
+	    { 24,0x1, 57,1}, { 31,0x1, 57,1}, { 41,0x1, 57,1}, { 56,0x3, 57,1},
+	},
+	/* state 22 */
+	{
+	    { 26,0x0,  0,0}, { 27,0x0,  0,0}, { 29,0x0,  0,0}, { 30,0x0,  0,0},
+	    { 33,0x0,  0,0}, { 34,0x0,  0,0}, { 36,0x0,  0,0}, { 37,0x0,  0,0},
+	    { 43,0x0,  0,0}, { 46,0x0,  0,0}, { 50,0x0,  0,0}, { 53,0x0,  0,0},
+	    { 58,0x0,  0,0}, { 61,0x0,  0,0}, { 65,0x0,  0,0}, { 68,0x2,  0,0},
+	},
+	/* state 23 */
+	{
+	    {  0,0x3, 61,4}, {  0,0x3, 65,4}, {  0,0x3, 95,4}, {  0,0x3, 98,4},
+	    {  0,0x3,100,4}, {  0,0x3,102,4}, {  0,0x3,103,4}, {  0,0x3,104,4},
+	    {  0,0x3,108,4}, {  0,0x3,109,4}, {  0,0x3,110,4}, {  0,0x3,112,4},
+	    {  0,0x3,114,4}, {  0,0x3,117,4}, { 38,0x0,  0,0}, { 39,0x0,  0,0},
+	},
+	/* state 24 */
+	{
+	    {  1,0x1, 61,3}, { 22,0x3, 61,3}, {  1,0x1, 65,3}, { 22,0x3, 65,3},
+	    {  1,0x1, 95,3}, { 22,0x3, 95,3}, {  1,0x1, 98,3}, { 22,0x3, 98,3},
+	    {  1,0x1,100,3}, { 22,0x3,100,3}, {  1,0x1,102,3}, { 22,0x3,102,3},
+	    {  1,0x1,103,3}, { 22,0x3,103,3}, {  1,0x1,104,3}, { 22,0x3,104,3},
+	},
+	/* state 25 */
+	{
+	    {  2,0x1, 61,2}, {  9,0x1, 61,2}, { 23,0x1, 61,2}, { 40,0x3, 61,2},
+	    {  2,0x1, 65,2}, {  9,0x1, 65,2}, { 23,0x1, 65,2}, { 40,0x3, 65,2},
+	    {  2,0x1, 95,2}, {  9,0x1, 95,2}, { 23,0x1, 95,2}, { 40,0x3, 95,2},
+	    {  2,0x1, 98,2}, {  9,0x1, 98,2}, { 23,0x1, 98,2}, { 40,0x3, 98,2},
+	},
+	/* state 26 */
+	{
+	    {  3,0x1, 61,1}, {  6,0x1, 61,1}, { 10,0x1, 61,1}, { 15,0x1, 61,1},
+	    { 24,0x1, 61,1}, { 31,0x1, 61,1}, { 41,0x1, 61,1}, { 56,0x3, 61,1},
+	    {  3,0x1, 65,1}, {  6,0x1, 65,1}, { 10,0x1, 65,1}, { 15,0x1, 65,1},
+	    { 24,0x1, 65,1}, { 31,0x1, 65,1}, { 41,0x1, 65,1}, { 56,0x3, 65,1},
+	},
+	/* state 27 */
+	{
+	    {  3,0x1, 95,1}, {  6,0x1, 95,1}, { 10,0x1, 95,1}, { 15,0x1, 95,1},
+	    { 24,0x1, 95,1}, { 31,0x1, 95,1}, { 41,0x1, 95,1}, { 56,0x3, 95,1},
+	    {  3,0x1, 98,1}, {  6,0x1, 98,1}, { 10,0x1, 98,1}, { 15,0x1, 98,1},
+	    { 24,0x1, 98,1}, { 31,0x1, 98,1}, { 41,0x1, 98,1}, { 56,0x3, 98,1},
+	},
+	/* state 28 */
+	{
+	    {  2,0x1,100,2}, {  9,0x1,100,2}, { 23,0x1,100,2}, { 40,0x3,100,2},
+	    {  2,0x1,102,2}, {  9,0x1,102,2}, { 23,0x1,102,2}, { 40,0x3,102,2},
+	    {  2,0x1,103,2}, {  9,0x1,103,2}, { 23,0x1,103,2}, { 40,0x3,103,2},
+	    {  2,0x1,104,2}, {  9,0x1,104,2}, { 23,0x1,104,2}, { 40,0x3,104,2},
+	},
+	/* state 29 */
+	{
+	    {  3,0x1,100,1}, {  6,0x1,100,1}, { 10,0x1,100,1}, { 15,0x1,100,1},
+	    { 24,0x1,100,1}, { 31,0x1,100,1}, { 41,0x1,100,1}, { 56,0x3,100,1},
+	    {  3,0x1,102,1}, {  6,0x1,102,1}, { 10,0x1,102,1}, { 15,0x1,102,1},
+	    { 24,0x1,102,1}, { 31,0x1,102,1}, { 41,0x1,102,1}, { 56,0x3,102,1},
+	},
+	/* state 30 */
+	{
+	    {  3,0x1,103,1}, {  6,0x1,103,1}, { 10,0x1,103,1}, { 15,0x1,103,1},
+	    { 24,0x1,103,1}, { 31,0x1,103,1}, { 41,0x1,103,1}, { 56,0x3,103,1},
+	    {  3,0x1,104,1}, {  6,0x1,104,1}, { 10,0x1,104,1}, { 15,0x1,104,1},
+	    { 24,0x1,104,1}, { 31,0x1,104,1}, { 41,0x1,104,1}, { 56,0x3,104,1},
+	},
+	/* state 31 */
+	{
+	    {  1,0x1,108,3}, { 22,0x3,108,3}, {  1,0x1,109,3}, { 22,0x3,109,3},
+	    {  1,0x1,110,3}, { 22,0x3,110,3}, {  1,0x1,112,3}, { 22,0x3,112,3},
+	    {  1,0x1,114,3}, { 22,0x3,114,3}, {  1,0x1,117,3}, { 22,0x3,117,3},
+	    {  0,0x3, 58,4}, {  0,0x3, 66,4}, {  0,0x3, 67,4}, {  0,0x3, 68,4},
+	},
+	/* state 32 */
+	{
+	    {  2,0x1,108,2}, {  9,0x1,108,2}, { 23,0x1,108,2}, { 40,0x3,108,2},
+	    {  2,0x1,109,2}, {  9,0x1,109,2}, { 23,0x1,109,2}, { 40,0x3,109,2},
+	    {  2,0x1,110,2}, {  9,0x1,110,2}, { 23,0x1,110,2}, { 40,0x3,110,2},
+	    {  2,0x1,112,2}, {  9,0x1,112,2}, { 23,0x1,112,2}, { 40,0x3,112,2},
+	},
+	/* state 33 */
+	{
+	    {  3,0x1,108,1}, {  6,0x1,108,1}, { 10,0x1,108,1}, { 15,0x1,108,1},
+	    { 24,0x1,108,1}, { 31,0x1,108,1}, { 41,0x1,108,1}, { 56,0x3,108,1},
+	    {  3,0x1,109,1}, {  6,0x1,109,1}, { 10,0x1,109,1}, { 15,0x1,109,1},
+	    { 24,0x1,109,1}, { 31,0x1,109,1}, { 41,0x1,109,1}, { 56,0x3,109,1},
+	},
+	/* state 34 */
+	{
+	    {  3,0x1,110,1}, {  6,0x1,110,1}, { 10,0x1,110,1}, { 15,0x1,110,1},
+	    { 24,0x1,110,1}, { 31,0x1,110,1}, { 41,0x1,110,1}, { 56,0x3,110,1},
+	    {  3,0x1,112,1}, {  6,0x1,112,1}, { 10,0x1,112,1}, { 15,0x1,112,1},
+	    { 24,0x1,112,1}, { 31,0x1,112,1}, { 41,0x1,112,1}, { 56,0x3,112,1},
+	},
+	/* state 35 */
+	{
+	    {  2,0x1,114,2}, {  9,0x1,114,2}, { 23,0x1,114,2}, { 40,0x3,114,2},
+	    {  2,0x1,117,2}, {  9,0x1,117,2}, { 23,0x1,117,2}, { 40,0x3,117,2},
+	    {  1,0x1, 58,3}, { 22,0x3, 58,3}, {  1,0x1, 66,3}, { 22,0x3, 66,3},
+	    {  1,0x1, 67,3}, { 22,0x3, 67,3}, {  1,0x1, 68,3}, { 22,0x3, 68,3},
+	},
+	/* state 36 */
+	{
+	    {  3,0x1,114,1}, {  6,0x1,114,1}, { 10,0x1,114,1}, { 15,0x1,114,1},
+	    { 24,0x1,114,1}, { 31,0x1,114,1}, { 41,0x1,114,1}, { 56,0x3,114,1},
+	    {  3,0x1,117,1}, {  6,0x1,117,1}, { 10,0x1,117,1}, { 15,0x1,117,1},
+	    { 24,0x1,117,1}, { 31,0x1,117,1}, { 41,0x1,117,1}, { 56,0x3,117,1},
+	},
+	/* state 37 */
+	{
+	    {  2,0x1, 58,2}, {  9,0x1, 58,2}, { 23,0x1, 58,2}, { 40,0x3, 58,2},
+	    {  2,0x1, 66,2}, {  9,0x1, 66,2}, { 23,0x1, 66,2}, { 40,0x3, 66,2},
+	    {  2,0x1, 67,2}, {  9,0x1, 67,2}, { 23,0x1, 67,2}, { 40,0x3, 67,2},
+	    {  2,0x1, 68,2}, {  9,0x1, 68,2}, { 23,0x1, 68,2}, { 40,0x3, 68,2},
+	},
+	/* state 38 */
+	{
+	    {  3,0x1, 58,1}, {  6,0x1, 58,1}, { 10,0x1, 58,1}, { 15,0x1, 58,1},
+	    { 24,0x1, 58,1}, { 31,0x1, 58,1}, { 41,0x1, 58,1}, { 56,0x3, 58,1},
+	    {  3,0x1, 66,1}, {  6,0x1, 66,1}, { 10,0x1, 66,1}, { 15,0x1, 66,1},
+	    { 24,0x1, 66,1}, { 31,0x1, 66,1}, { 41,0x1, 66,1}, { 56,0x3, 66,1},
+	},
+	/* state 39 */
+	{
+	    {  3,0x1, 67,1}, {  6,0x1, 67,1}, { 10,0x1, 67,1}, { 15,0x1, 67,1},
+	    { 24,0x1, 67,1}, { 31,0x1, 67,1}, { 41,0x1, 67,1}, { 56,0x3, 67,1},
+	    {  3,0x1, 68,1}, {  6,0x1, 68,1}, { 10,0x1, 68,1}, { 15,0x1, 68,1},
+	    { 24,0x1, 68,1}, { 31,0x1, 68,1}, { 41,0x1, 68,1}, { 56,0x3, 68,1},
+	},
+	/* state 40 */
+	{
+	    { 44,0x0,  0,0}, { 45,0x0,  0,0}, { 47,0x0,  0,0}, { 48,0x0,  0,0},
+	    { 51,0x0,  0,0}, { 52,0x0,  0,0}, { 54,0x0,  0,0}, { 55,0x0,  0,0},
+	    { 59,0x0,  0,0}, { 60,0x0,  0,0}, { 62,0x0,  0,0}, { 63,0x0,  0,0},
+	    { 66,0x0,  0,0}, { 67,0x0,  0,0}, { 69,0x0,  0,0}, { 72,0x2,  0,0},
+	},
+	/* state 41 */
+	{
+	    {  0,0x3, 69,4}, {  0,0x3, 70,4}, {  0,0x3, 71,4}, {  0,0x3, 72,4},
+	    {  0,0x3, 73,4}, {  0,0x3, 74,4}, {  0,0x3, 75,4}, {  0,0x3, 76,4},
+	    {  0,0x3, 77,4}, {  0,0x3, 78,4}, {  0,0x3, 79,4}, {  0,0x3, 80,4},
+	    {  0,0x3, 81,4}, {  0,0x3, 82,4}, {  0,0x3, 83,4}, {  0,0x3, 84,4},
+	},
+	/* state 42 */
+	{
+	    {  1,0x1, 69,3}, { 22,0x3, 69,3}, {  1,0x1, 70,3}, { 22,0x3, 70,3},
+	    {  1,0x1, 71,3}, { 22,0x3, 71,3}, {  1,0x1, 72,3}, { 22,0x3, 72,3},
+	    {  1,0x1, 73,3}, { 22,0x3, 73,3}, {  1,0x1, 74,3}, { 22,0x3, 74,3},
+	    {  1,0x1, 75,3}, { 22,0x3, 75,3}, {  1,0x1, 76,3}, { 22,0x3, 76,3},
+	},
+	/* state 43 */
+	{
+	    {  2,0x1, 69,2}, {  9,0x1, 69,2}, { 23,0x1, 69,2}, { 40,0x3, 69,2},
+	    {  2,0x1, 70,2}, {  9,0x1, 70,2}, { 23,0x1, 70,2}, { 40,0x3, 70,2},
+	    {  2,0x1, 71,2}, {  9,0x1, 71,2}, { 23,0x1, 71,2}, { 40,0x3, 71,2},
+	    {  2,0x1, 72,2}, {  9,0x1, 72,2}, { 23,0x1, 72,2}, { 40,0x3, 72,2},
+	},
+	/* state 44 */
+	{
+	    {  3,0x1, 69,1}, {  6,0x1, 69,1}, { 10,0x1, 69,1}, { 15,0x1, 69,1},
+	    { 24,0x1, 69,1}, { 31,0x1, 69,1}, { 41,0x1, 69,1}, { 56,0x3, 69,1},
+	    {  3,0x1, 70,1}, {  6,0x1, 70,1}, { 10,0x1, 70,1}, { 15,0x1, 70,1},
+	    { 24,0x1, 70,1}, { 31,0x1, 70,1}, { 41,0x1, 70,1}, { 56,0x3, 70,1},
+	},
+	/* state 45 */
+	{
+	    {  3,0x1, 71,1}, {  6,0x1, 71,1}, { 10,0x1, 71,1}, { 15,0x1, 71,1},
+	    { 24,0x1, 71,1}, { 31,0x1, 71,1}, { 41,0x1, 71,1}, { 56,0x3, 71,1},
+	    {  3,0x1, 72,1}, {  6,0x1, 72,1}, { 10,0x1, 72,1}, { 15,0x1, 72,1},
+	    { 24,0x1, 72,1}, { 31,0x1, 72,1}, { 41,0x1, 72,1}, { 56,0x3, 72,1},
+	},
+	/* state 46 */
+	{
+	    {  2,0x1, 73,2}, {  9,0x1, 73,2}, { 23,0x1, 73,2}, { 40,0x3, 73,2},
+	    {  2,0x1, 74,2}, {  9,0x1, 74,2}, { 23,0x1, 74,2}, { 40,0x3, 74,2},
+	    {  2,0x1, 75,2}, {  9,0x1, 75,2}, { 23,0x1, 75,2}, { 40,0x3, 75,2},
+	    {  2,0x1, 76,2}, {  9,0x1, 76,2}, { 23,0x1, 76,2}, { 40,0x3, 76,2},
+	},
+	/* state 47 */
+	{
+	    {  3,0x1, 73,1}, {  6,0x1, 73,1}, { 10,0x1, 73,1}, { 15,0x1, 73,1},
+	    { 24,0x1, 73,1}, { 31,0x1, 73,1}, { 41,0x1, 73,1}, { 56,0x3, 73,1},
+	    {  3,0x1, 74,1}, {  6,0x1, 74,1}, { 10,0x1, 74,1}, { 15,0x1, 74,1},
+	    { 24,0x1, 74,1}, { 31,0x1, 74,1}, { 41,0x1, 74,1}, { 56,0x3, 74,1},
+	},
+	/* state 48 */
+	{
+	    {  3,0x1, 75,1}, {  6,0x1, 75,1}, { 10,0x1, 75,1}, { 15,0x1, 75,1},
+	    { 24,0x1, 75,1}, { 31,0x1, 75,1}, { 41,0x1, 75,1}, { 56,0x3, 75,1},
+	    {  3,0x1, 76,1}, {  6,0x1, 76,1}, { 10,0x1, 76,1}, { 15,0x1, 76,1},
+	    { 24,0x1, 76,1}, { 31,0x1, 76,1}, { 41,0x1, 76,1}, { 56,0x3, 76,1},
+	},
+	/* state 49 */
+	{
+	    {  1,0x1, 77,3}, { 22,0x3, 77,3}, {  1,0x1, 78,3}, { 22,0x3, 78,3},
+	    {  1,0x1, 79,3}, { 22,0x3, 79,3}, {  1,0x1, 80,3}, { 22,0x3, 80,3},
+	    {  1,0x1, 81,3}, { 22,0x3, 81,3}, {  1,0x1, 82,3}, { 22,0x3, 82,3},
+	    {  1,0x1, 83,3}, { 22,0x3, 83,3}, {  1,0x1, 84,3}, { 22,0x3, 84,3},
+	},
+	/* state 50 */
+	{
+	    {  2,0x1, 77,2}, {  9,0x1, 77,2}, { 23,0x1, 77,2}, { 40,0x3, 77,2},
+	    {  2,0x1, 78,2}, {  9,0x1, 78,2}, { 23,0x1, 78,2}, { 40,0x3, 78,2},
+	    {  2,0x1, 79,2}, {  9,0x1, 79,2}, { 23,0x1, 79,2}, { 40,0x3, 79,2},
+	    {  2,0x1, 80,2}, {  9,0x1, 80,2}, { 23,0x1, 80,2}, { 40,0x3, 80,2},
+	},
+	/* state 51 */
+	{
+	    {  3,0x1, 77,1}, {  6,0x1, 77,1}, { 10,0x1, 77,1}, { 15,0x1, 77,1},
+	    { 24,0x1, 77,1}, { 31,0x1, 77,1}, { 41,0x1, 77,1}, { 56,0x3, 77,1},
+	    {  3,0x1, 78,1}, {  6,0x1, 78,1}, { 10,0x1, 78,1}, { 15,0x1, 78,1},
+	    { 24,0x1, 78,1}, { 31,0x1, 78,1}, { 41,0x1, 78,1}, { 56,0x3, 78,1},
+	},
+	/* state 52 */
+	{
+	    {  3,0x1, 79,1}, {  6,0x1, 79,1}, { 10,0x1, 79,1}, { 15,0x1, 79,1},
+	    { 24,0x1, 79,1}, { 31,0x1, 79,1}, { 41,0x1, 79,1}, { 56,0x3, 79,1},
+	    {  3,0x1, 80,1}, {  6,0x1, 80,1}, { 10,0x1, 80,1}, { 15,0x1, 80,1},
+	    { 24,0x1, 80,1}, { 31,0x1, 80,1}, { 41,0x1, 80,1}, { 56,0x3, 80,1},
+	},
+	/* state 53 */
+	{
+	    {  2,0x1, 81,2}, {  9,0x1, 81,2}, { 23,0x1, 81,2}, { 40,0x3, 81,2},
+	    {  2,0x1, 82,2}, {  9,0x1, 82,2}, { 23,0x1, 82,2}, { 40,0x3, 82,2},
+	    {  2,0x1, 83,2}, {  9,0x1, 83,2}, { 23,0x1, 83,2}, { 40,0x3, 83,2},
+	    {  2,0x1, 84,2}, {  9,0x1, 84,2}, { 23,0x1, 84,2}, { 40,0x3, 84,2},
+	},
+	/* state 54 */
+	{
+	    {  3,0x1, 81,1}, {  6,0x1, 81,1}, { 10,0x1, 81,1}, { 15,0x1, 81,1},
+	    { 24,0x1, 81,1}, { 31,0x1, 81,1}, { 41,0x1, 81,1}, { 56,0x3, 81,1},
+	    {  3,0x1, 82,1}, {  6,0x1, 82,1}, { 10,0x1, 82,1}, { 15,0x1, 82,1},
+	    { 24,0x1, 82,1}, { 31,0x1, 82,1}, { 41,0x1, 82,1}, { 56,0x3, 82,1},
+	},
+	/* state 55 */
+	{
+	    {  3,0x1, 83,1}, {  6,0x1, 83,1}, { 10,0x1, 83,1}, { 15,0x1, 83,1},
+	    { 24,0x1, 83,1}, { 31,0x1, 83,1}, { 41,0x1, 83,1}, { 56,0x3, 83,1},
+	    {  3,0x1, 84,1}, {  6,0x1, 84,1}, { 10,0x1, 84,1}, { 15,0x1, 84,1},
+	    { 24,0x1, 84,1}, { 31,0x1, 84,1}, { 41,0x1, 84,1}, { 56,0x3, 84,1},
+	},
+	/* state 56 */
+	{
+	    {  0,0x3, 85,4}, {  0,0x3, 86,4}, {  0,0x3, 87,4}, {  0,0x3, 89,4},
+	    {  0,0x3,106,4}, {  0,0x3,107,4}, {  0,0x3,113,4}, {  0,0x3,118,4},
+	    {  0,0x3,119,4}, {  0,0x3,120,4}, {  0,0x3,121,4}, {  0,0x3,122,4},
+	    { 70,0x0,  0,0}, { 71,0x0,  0,0}, { 73,0x0,  0,0}, { 74,0x2,  0,0},
+	},
+	/* state 57 */
+	{
+	    {  1,0x1, 85,3}, { 22,0x3, 85,3}, {  1,0x1, 86,3}, { 22,0x3, 86,3},
+	    {  1,0x1, 87,3}, { 22,0x3, 87,3}, {  1,0x1, 89,3}, { 22,0x3, 89,3},
+	    {  1,0x1,106,3}, { 22,0x3,106,3}, {  1,0x1,107,3}, { 22,0x3,107,3},
+	    {  1,0x1,113,3}, { 22,0x3,113,3}, {  1,0x1,118,3}, { 22,0x3,118,3},
+	},
+	/* state 58 */
+	{
+	    {  2,0x1, 85,2}, {  9,0x1, 85,2}, { 23,0x1, 85,2}, { 40,0x3, 85,2},
+	    {  2,0x1, 86,2}, {  9,0x1, 86,2}, { 23,0x1, 86,2}, { 40,0x3, 86,2},
+	    {  2,0x1, 87,2}, {  9,0x1, 87,2}, { 23,0x1, 87,2}, { 40,0x3, 87,2},
+	    {  2,0x1, 89,2}, {  9,0x1, 89,2}, { 23,0x1, 89,2}, { 40,0x3, 89,2},
+	},
+	/* state 59 */
+	{
+	    {  3,0x1, 85,1}, {  6,0x1, 85,1}, { 10,0x1, 85,1}, { 15,0x1, 85,1},
+	    { 24,0x1, 85,1}, { 31,0x1, 85,1}, { 41,0x1, 85,1}, { 56,0x3, 85,1},
+	    {  3,0x1, 86,1}, {  6,0x1, 86,1}, { 10,0x1, 86,1}, { 15,0x1, 86,1},
+	    { 24,0x1, 86,1}, { 31,0x1, 86,1}, { 41,0x1, 86,1}, { 56,0x3, 86,1},
+	},
+	/* state 60 */
+	{
+	    {  3,0x1, 87,1}, {  6,0x1, 87,1}, { 10,0x1, 87,1}, { 15,0x1, 87,1},
+	    { 24,0x1, 87,1}, { 31,0x1, 87,1}, { 41,0x1, 87,1}, { 56,0x3, 87,1},
+	    {  3,0x1, 89,1}, {  6,0x1, 89,1}, { 10,0x1, 89,1}, { 15,0x1, 89,1},
+	    { 24,0x1, 89,1}, { 31,0x1, 89,1}, { 41,0x1, 89,1}, { 56,0x3, 89,1},
+	},
+	/* state 61 */
+	{
+	    {  2,0x1,106,2}, {  9,0x1,106,2}, { 23,0x1,106,2}, { 40,0x3,106,2},
+	    {  2,0x1,107,2}, {  9,0x1,107,2}, { 23,0x1,107,2}, { 40,0x3,107,2},
+	    {  2,0x1,113,2}, {  9,0x1,113,2}, { 23,0x1,113,2}, { 40,0x3,113,2},
+	    {  2,0x1,118,2}, {  9,0x1,118,2}, { 23,0x1,118,2}, { 40,0x3,118,2},
+	},
+	/* state 62 */
+	{
+	    {  3,0x1,106,1}, {  6,0x1,106,1}, { 10,0x1,106,1}, { 15,0x1,106,1},
+	    { 24,0x1,106,1}, { 31,0x1,106,1}, { 41,0x1,106,1}, { 56,0x3,106,1},
+	    {  3,0x1,107,1}, {  6,0x1,107,1}, { 10,0x1,107,1}, { 15,0x1,107,1},
+	    { 24,0x1,107,1}, { 31,0x1,107,1}, { 41,0x1,107,1}, { 56,0x3,107,1},
+	},
+	/* state 63 */
+	{
+	    {  3,0x1,113,1}, {  6,0x1,113,1}, { 10,0x1,113,1}, { 15,0x1,113,1},
+	    { 24,0x1,113,1}, { 31,0x1,113,1}, { 41,0x1,113,1}, { 56,0x3,113,1},
+	    {  3,0x1,118,1}, {  6,0x1,118,1}, { 10,0x1,118,1}, { 15,0x1,118,1},
+	    { 24,0x1,118,1}, { 31,0x1,118,1}, { 41,0x1,118,1}, { 56,0x3,118,1},
+	},
+	/* state 64 */
+	{
+	    {  1,0x1,119,3}, { 22,0x3,119,3}, {  1,0x1,120,3}, { 22,0x3,120,3},
+	    {  1,0x1,121,3}, { 22,0x3,121,3}, {  1,0x1,122,3}, { 22,0x3,122,3},
+	    {  0,0x3, 38,4}, {  0,0x3, 42,4}, {  0,0x3, 44,4}, {  0,0x3, 59,4},
+	    {  0,0x3, 88,4}, {  0,0x3, 90,4}, { 75,0x0,  0,0}, { 78,0x0,  0,0},
+	},
+	/* state 65 */
+	{
+	    {  2,0x1,119,2}, {  9,0x1,119,2}, { 23,0x1,119,2}, { 40,0x3,119,2},
+	    {  2,0x1,120,2}, {  9,0x1,120,2}, { 23,0x1,120,2}, { 40,0x3,120,2},
+	    {  2,0x1,121,2}, {  9,0x1,121,2}, { 23,0x1,121,2}, { 40,0x3,121,2},
+	    {  2,0x1,122,2}, {  9,0x1,122,2}, { 23,0x1,122,2}, { 40,0x3,122,2},
+	},
+	/* state 66 */
+	{
+	    {  3,0x1,119,1}, {  6,0x1,119,1}, { 10,0x1,119,1}, { 15,0x1,119,1},
+	    { 24,0x1,119,1}, { 31,0x1,119,1}, { 41,0x1,119,1}, { 56,0x3,119,1},
+	    {  3,0x1,120,1}, {  6,0x1,120,1}, { 10,0x1,120,1}, { 15,0x1,120,1},
+	    { 24,0x1,120,1}, { 31,0x1,120,1}, { 41,0x1,120,1}, { 56,0x3,120,1},
+	},
+	/* state 67 */
+	{
+	    {  3,0x1,121,1}, {  6,0x1,121,1}, { 10,0x1,121,1}, { 15,0x1,121,1},
+	    { 24,0x1,121,1}, { 31,0x1,121,1}, { 41,0x1,121,1}, { 56,0x3,121,1},
+	    {  3,0x1,122,1}, {  6,0x1,122,1}, { 10,0x1,122,1}, { 15,0x1,122,1},
+	    { 24,0x1,122,1}, { 31,0x1,122,1}, { 41,0x1,122,1}, { 56,0x3,122,1},
+	},
+	/* state 68 */
+	{
+	    {  1,0x1, 38,3}, { 22,0x3, 38,3}, {  1,0x1, 42,3}, { 22,0x3, 42,3},
+	    {  1,0x1, 44,3}, { 22,0x3, 44,3}, {  1,0x1, 59,3}, { 22,0x3, 59,3},
+	    {  1,0x1, 88,3}, { 22,0x3, 88,3}, {  1,0x1, 90,3}, { 22,0x3, 90,3},
+	    { 76,0x0,  0,0}, { 77,0x0,  0,0}, { 79,0x0,  0,0}, { 81,0x0,  0,0},
+	},
+	/* state 69 */
+	{
+	    {  2,0x1, 38,2}, {  9,0x1, 38,2}, { 23,0x1, 38,2}, { 40,0x3, 38,2},
+	    {  2,0x1, 42,2}, {  9,0x1, 42,2}, { 23,0x1, 42,2}, { 40,0x3, 42,2},
+	    {  2,0x1, 44,2}, {  9,0x1, 44,2}, { 23,0x1, 44,2}, { 40,0x3, 44,2},
+	    {  2,0x1, 59,2}, {  9,0x1, 59,2}, { 23,0x1, 59,2}, { 40,0x3, 59,2},
+	},
+	/* state 70 */
+	{
+	    {  3,0x1, 38,1}, {  6,0x1, 38,1}, { 10,0x1, 38,1}, { 15,0x1, 38,1},
+	    { 24,0x1, 38,1}, { 31,0x1, 38,1}, { 41,0x1, 38,1}, { 56,0x3, 38,1},
+	    {  3,0x1, 42,1}, {  6,0x1, 42,1}, { 10,0x1, 42,1}, { 15,0x1, 42,1},
+	    { 24,0x1, 42,1}, { 31,0x1, 42,1}, { 41,0x1, 42,1}, { 56,0x3, 42,1},
+	},
+	/* state 71 */
+	{
+	    {  3,0x1, 44,1}, {  6,0x1, 44,1}, { 10,0x1, 44,1}, { 15,0x1, 44,1},
+	    { 24,0x1, 44,1}, { 31,0x1, 44,1}, { 41,0x1, 44,1}, { 56,0x3, 44,1},
+	    {  3,0x1, 59,1}, {  6,0x1, 59,1}, { 10,0x1, 59,1}, { 15,0x1, 59,1},
+	    { 24,0x1, 59,1}, { 31,0x1, 59,1}, { 41,0x1, 59,1}, { 56,0x3, 59,1},
+	},
+	/* state 72 */
+	{
+	    {  2,0x1, 88,2}, {  9,0x1, 88,2}, { 23,0x1, 88,2}, { 40,0x3, 88,2},
+	    {  2,0x1, 90,2}, {  9,0x1, 90,2}, { 23,0x1, 90,2}, { 40,0x3, 90,2},
+	    {  0,0x3, 33,4}, {  0,0x3, 34,4}, {  0,0x3, 40,4}, {  0,0x3, 41,4},
+	    {  0,0x3, 63,4}, { 80,0x0,  0,0}, { 82,0x0,  0,0}, { 84,0x0,  0,0},
+	},
+	/* state 73 */
+	{
+	    {  3,0x1, 88,1}, {  6,0x1, 88,1}, { 10,0x1, 88,1}, { 15,0x1, 88,1},
+	    { 24,0x1, 88,1}, { 31,0x1, 88,1}, { 41,0x1, 88,1}, { 56,0x3, 88,1},
+	    {  3,0x1, 90,1}, {  6,0x1, 90,1}, { 10,0x1, 90,1}, { 15,0x1, 90,1},
+	    { 24,0x1, 90,1}, { 31,0x1, 90,1}, { 41,0x1, 90,1}, { 56,0x3, 90,1},
+	},
+	/* state 74 */
+	{
+	    {  1,0x1, 33,3}, { 22,0x3, 33,3}, {  1,0x1, 34,3}, { 22,0x3, 34,3},
+	    {  1,0x1, 40,3}, { 22,0x3, 40,3}, {  1,0x1, 41,3}, { 22,0x3, 41,3},
+	    {  1,0x1, 63,3}, { 22,0x3, 63,3}, {  0,0x3, 39,4}, {  0,0x3, 43,4},
+	    {  0,0x3,124,4}, { 83,0x0,  0,0}, { 85,0x0,  0,0}, { 88,0x0,  0,0},
+	},
+	/* state 75 */
+	{
+	    {  2,0x1, 33,2}, {  9,0x1, 33,2}, { 23,0x1, 33,2}, { 40,0x3, 33,2},
+	    {  2,0x1, 34,2}, {  9,0x1, 34,2}, { 23,0x1, 34,2}, { 40,0x3, 34,2},
+	    {  2,0x1, 40,2}, {  9,0x1, 40,2}, { 23,0x1, 40,2}, { 40,0x3, 40,2},
+	    {  2,0x1, 41,2}, {  9,0x1, 41,2}, { 23,0x1, 41,2}, { 40,0x3, 41,2},
+	},
+	/* state 76 */
+	{
+	    {  3,0x1, 33,1}, {  6,0x1, 33,1}, { 10,0x1, 33,1}, { 15,0x1, 33,1},
+	    { 24,0x1, 33,1}, { 31,0x1, 33,1}, { 41,0x1, 33,1}, { 56,0x3, 33,1},
+	    {  3,0x1, 34,1}, {  6,0x1, 34,1}, { 10,0x1, 34,1}, { 15,0x1, 34,1},
+	    { 24,0x1, 34,1}, { 31,0x1, 34,1}, { 41,0x1, 34,1}, { 56,0x3, 34,1},
+	},
+	/* state 77 */
+	{
+	    {  3,0x1, 40,1}, {  6,0x1, 40,1}, { 10,0x1, 40,1}, { 15,0x1, 40,1},
+	    { 24,0x1, 40,1}, { 31,0x1, 40,1}, { 41,0x1, 40,1}, { 56,0x3, 40,1},
+	    {  3,0x1, 41,1}, {  6,0x1, 41,1}, { 10,0x1, 41,1}, { 15,0x1, 41,1},
+	    { 24,0x1, 41,1}, { 31,0x1, 41,1}, { 41,0x1, 41,1}, { 56,0x3, 41,1},
+	},
+	/* state 78 */
+	{
+	    {  2,0x1, 63,2}, {  9,0x1, 63,2}, { 23,0x1, 63,2}, { 40,0x3, 63,2},
+	    {  1,0x1, 39,3}, { 22,0x3, 39,3}, {  1,0x1, 43,3}, { 22,0x3, 43,3},
+	    {  1,0x1,124,3}, { 22,0x3,124,3}, {  0,0x3, 35,4}, {  0,0x3, 62,4},
+	    { 86,0x0,  0,0}, { 87,0x0,  0,0}, { 89,0x0,  0,0}, { 90,0x0,  0,0},
+	},
+	/* state 79 */
+	{
+	    {  3,0x1, 63,1}, {  6,0x1, 63,1}, { 10,0x1, 63,1}, { 15,0x1, 63,1},
+	    { 24,0x1, 63,1}, { 31,0x1, 63,1}, { 41,0x1, 63,1}, { 56,0x3, 63,1},
+	    {  2,0x1, 39,2}, {  9,0x1, 39,2}, { 23,0x1, 39,2}, { 40,0x3, 39,2},
+	    {  2,0x1, 43,2}, {  9,0x1, 43,2}, { 23,0x1, 43,2}, { 40,0x3, 43,2},
+	},
+	/* state 80 */
+	{
+	    {  3,0x1, 39,1}, {  6,0x1, 39,1}, { 10,0x1, 39,1}, { 15,0x1, 39,1},
+	    { 24,0x1, 39,1}, { 31,0x1, 39,1}, { 41,0x1, 39,1}, { 56,0x3, 39,1},
+	    {  3,0x1, 43,1}, {  6,0x1, 43,1}, { 10,0x1, 43,1}, { 15,0x1, 43,1},
+	    { 24,0x1, 43,1}, { 31,0x1, 43,1}, { 41,0x1, 43,1}, { 56,0x3, 43,1},
+	},
+	/* state 81 */
+	{
+	    {  2,0x1,124,2}, {  9,0x1,124,2}, { 23,0x1,124,2}, { 40,0x3,124,2},
+	    {  1,0x1, 35,3}, { 22,0x3, 35,3}, {  1,0x1, 62,3}, { 22,0x3, 62,3},
+	    {  0,0x3,  0,4}, {  0,0x3, 36,4}, {  0,0x3, 64,4}, {  0,0x3, 91,4},
+	    {  0,0x3, 93,4}, {  0,0x3,126,4}, { 91,0x0,  0,0}, { 92,0x0,  0,0},
+	},
+	/* state 82 */
+	{
+	    {  3,0x1,124,1}, {  6,0x1,124,1}, { 10,0x1,124,1}, { 15,0x1,124,1},
+	    { 24,0x1,124,1}, { 31,0x1,124,1}, { 41,0x1,124,1}, { 56,0x3,124,1},
+	    {  2,0x1, 35,2}, {  9,0x1, 35,2}, { 23,0x1, 35,2}, { 40,0x3, 35,2},
+	    {  2,0x1, 62,2}, {  9,0x1, 62,2}, { 23,0x1, 62,2}, { 40,0x3, 62,2},
+	},
+	/* state 83 */
+	{
+	    {  3,0x1, 35,1}, {  6,0x1, 35,1}, { 10,0x1, 35,1}, { 15,0x1, 35,1},
+	    { 24,0x1, 35,1}, { 31,0x1, 35,1}, { 41,0x1, 35,1}, { 56,0x3, 35,1},
+	    {  3,0x1, 62,1}, {  6,0x1, 62,1}, { 10,0x1, 62,1}, { 15,0x1, 62,1},
+	    { 24,0x1, 62,1}, { 31,0x1, 62,1}, { 41,0x1, 62,1}, { 56,0x3, 62,1},
+	},
+	/* state 84 */
+	{
+	    {  1,0x1,  0,3}, { 22,0x3,  0,3}, {  1,0x1, 36,3}, { 22,0x3, 36,3},
+	    {  1,0x1, 64,3}, { 22,0x3, 64,3}, {  1,0x1, 91,3}, { 22,0x3, 91,3},
+	    {  1,0x1, 93,3}, { 22,0x3, 93,3}, {  1,0x1,126,3}, { 22,0x3,126,3},
+	    {  0,0x3, 94,4}, {  0,0x3,125,4}, { 93,0x0,  0,0}, { 94,0x0,  0,0},
+	},
+	/* state 85 */
+	{
+	    {  2,0x1,  0,2}, {  9,0x1,  0,2}, { 23,0x1,  0,2}, { 40,0x3,  0,2},
+	    {  2,0x1, 36,2}, {  9,0x1, 36,2}, { 23,0x1, 36,2}, { 40,0x3, 36,2},
+	    {  2,0x1, 64,2}, {  9,0x1, 64,2}, { 23,0x1, 64,2}, { 40,0x3, 64,2},
+	    {  2,0x1, 91,2}, {  9,0x1, 91,2}, { 23,0x1, 91,2}, { 40,0x3, 91,2},
+	},
+	/* state 86 */
+	{
+	    {  3,0x1,  0,1}, {  6,0x1,  0,1}, { 10,0x1,  0,1}, { 15,0x1,  0,1},
+	    { 24,0x1,  0,1}, { 31,0x1,  0,1}, { 41,0x1,  0,1}, { 56,0x3,  0,1},
+	    {  3,0x1, 36,1}, {  6,0x1, 36,1}, { 10,0x1, 36,1}, { 15,0x1, 36,1},
+	    { 24,0x1, 36,1}, { 31,0x1, 36,1}, { 41,0x1, 36,1}, { 56,0x3, 36,1},
+	},
+	/* state 87 */
+	{
+	    {  3,0x1, 64,1}, {  6,0x1, 64,1}, { 10,0x1, 64,1}, { 15,0x1, 64,1},
+	    { 24,0x1, 64,1}, { 31,0x1, 64,1}, { 41,0x1, 64,1}, { 56,0x3, 64,1},
+	    {  3,0x1, 91,1}, {  6,0x1, 91,1}, { 10,0x1, 91,1}, { 15,0x1, 91,1},
+	    { 24,0x1, 91,1}, { 31,0x1, 91,1}, { 41,0x1, 91,1}, { 56,0x3, 91,1},
+	},
+	/* state 88 */
+	{
+	    {  2,0x1, 93,2}, {  9,0x1, 93,2}, { 23,0x1, 93,2}, { 40,0x3, 93,2},
+	    {  2,0x1,126,2}, {  9,0x1,126,2}, { 23,0x1,126,2}, { 40,0x3,126,2},
+	    {  1,0x1, 94,3}, { 22,0x3, 94,3}, {  1,0x1,125,3}, { 22,0x3,125,3},
+	    {  0,0x3, 60,4}, {  0,0x3, 96,4}, {  0,0x3,123,4}, { 95,0x0,  0,0},
+	},
+	/* state 89 */
+	{
+	    {  3,0x1, 93,1}, {  6,0x1, 93,1}, { 10,0x1, 93,1}, { 15,0x1, 93,1},
+	    { 24,0x1, 93,1}, { 31,0x1, 93,1}, { 41,0x1, 93,1}, { 56,0x3, 93,1},
+	    {  3,0x1,126,1}, {  6,0x1,126,1}, { 10,0x1,126,1}, { 15,0x1,126,1},
+	    { 24,0x1,126,1}, { 31,0x1,126,1}, { 41,0x1,126,1}, { 56,0x3,126,1},
+	},
+	/* state 90 */
+	{
+	    {  2,0x1, 94,2}, {  9,0x1, 94,2}, { 23,0x1, 94,2}, { 40,0x3, 94,2},
+	    {  2,0x1,125,2}, {  9,0x1,125,2}, { 23,0x1,125,2}, { 40,0x3,125,2},
+	    {  1,0x1, 60,3}, { 22,0x3, 60,3}, {  1,0x1, 96,3}, { 22,0x3, 96,3},
+	    {  1,0x1,123,3}, { 22,0x3,123,3}, { 96,0x0,  0,0}, {110,0x0,  0,0},
+	},
+	/* state 91 */
+	{
+	    {  3,0x1, 94,1}, {  6,0x1, 94,1}, { 10,0x1, 94,1}, { 15,0x1, 94,1},
+	    { 24,0x1, 94,1}, { 31,0x1, 94,1}, { 41,0x1, 94,1}, { 56,0x3, 94,1},
+	    {  3,0x1,125,1}, {  6,0x1,125,1}, { 10,0x1,125,1}, { 15,0x1,125,1},
+	    { 24,0x1,125,1}, { 31,0x1,125,1}, { 41,0x1,125,1}, { 56,0x3,125,1},
+	},
+	/* state 92 */
+	{
+	    {  2,0x1, 60,2}, {  9,0x1, 60,2}, { 23,0x1, 60,2}, { 40,0x3, 60,2},
+	    {  2,0x1, 96,2}, {  9,0x1, 96,2}, { 23,0x1, 96,2}, { 40,0x3, 96,2},
+	    {  2,0x1,123,2}, {  9,0x1,123,2}, { 23,0x1,123,2}, { 40,0x3,123,2},
+	    { 97,0x0,  0,0}, {101,0x0,  0,0}, {111,0x0,  0,0}, {133,0x0,  0,0},
+	},
+	/* state 93 */
+	{
+	    {  3,0x1, 60,1}, {  6,0x1, 60,1}, { 10,0x1, 60,1}, { 15,0x1, 60,1},
+	    { 24,0x1, 60,1}, { 31,0x1, 60,1}, { 41,0x1, 60,1}, { 56,0x3, 60,1},
+	    {  3,0x1, 96,1}, {  6,0x1, 96,1}, { 10,0x1, 96,1}, { 15,0x1, 96,1},
+	    { 24,0x1, 96,1}, { 31,0x1, 96,1}, { 41,0x1, 96,1}, { 56,0x3, 96,1},
+	},
+	/* state 94 */
+	{
+	    {  3,0x1,123,1}, {  6,0x1,123,1}, { 10,0x1,123,1}, { 15,0x1,123,1},
+	    { 24,0x1,123,1}, { 31,0x1,123,1}, { 41,0x1,123,1}, { 56,0x3,123,1},
+	    { 98,0x0,  0,0}, { 99,0x0,  0,0}, {102,0x0,  0,0}, {105,0x0,  0,0},
+	    {112,0x0,  0,0}, {119,0x0,  0,0}, {134,0x0,  0,0}, {153,0x0,  0,0},
+	},
+	/* state 95 */
+	{
+	    {  0,0x3, 92,4}, {  0,0x3,195,4}, {  0,0x3,208,4}, {100,0x0,  0,0},
+	    {103,0x0,  0,0}, {104,0x0,  0,0}, {106,0x0,  0,0}, {107,0x0,  0,0},
+	    {113,0x0,  0,0}, {116,0x0,  0,0}, {120,0x0,  0,0}, {126,0x0,  0,0},
+	    {135,0x0,  0,0}, {142,0x0,  0,0}, {154,0x0,  0,0}, {169,0x0,  0,0},
+	},
+	/* state 96 */
+	{
+	    {  1,0x1, 92,3}, { 22,0x3, 92,3}, {  1,0x1,195,3}, { 22,0x3,195,3},
+	    {  1,0x1,208,3}, { 22,0x3,208,3}, {  0,0x3,128,4}, {  0,0x3,130,4},
+	    {  0,0x3,131,4}, {  0,0x3,162,4}, {  0,0x3,184,4}, {  0,0x3,194,4},
+	    {  0,0x3,224,4}, {  0,0x3,226,4}, {108,0x0,  0,0}, {109,0x0,  0,0},
+	},
+	/* state 97 */
+	{
+	    {  2,0x1, 92,2}, {  9,0x1, 92,2}, { 23,0x1, 92,2}, { 40,0x3, 92,2},
+	    {  2,0x1,195,2}, {  9,0x1,195,2}, { 23,0x1,195,2}, { 40,0x3,195,2},
+	    {  2,0x1,208,2}, {  9,0x1,208,2}, { 23,0x1,208,2}, { 40,0x3,208,2},
+	    {  1,0x1,128,3}, { 22,0x3,128,3}, {  1,0x1,130,3}, { 22,0x3,130,3},
+	},
+	/* state 98 */
+	{
+	    {  3,0x1, 92,1}, {  6,0x1, 92,1}, { 10,0x1, 92,1}, { 15,0x1, 92,1},
+	    { 24,0x1, 92,1}, { 31,0x1, 92,1}, { 41,0x1, 92,1}, { 56,0x3, 92,1},
+	    {  3,0x1,195,1}, {  6,0x1,195,1}, { 10,0x1,195,1}, { 15,0x1,195,1},
+	    { 24,0x1,195,1}, { 31,0x1,195,1}, { 41,0x1,195,1}, { 56,0x3,195,1},
+	},
+	/* state 99 */
+	{
+	    {  3,0x1,208,1}, {  6,0x1,208,1}, { 10,0x1,208,1}, { 15,0x1,208,1},
+	    { 24,0x1,208,1}, { 31,0x1,208,1}, { 41,0x1,208,1}, { 56,0x3,208,1},
+	    {  2,0x1,128,2}, {  9,0x1,128,2}, { 23,0x1,128,2}, { 40,0x3,128,2},
+	    {  2,0x1,130,2}, {  9,0x1,130,2}, { 23,0x1,130,2}, { 40,0x3,130,2},
+	},
+	/* state 100 */
+	{
+	    {  3,0x1,128,1}, {  6,0x1,128,1}, { 10,0x1,128,1}, { 15,0x1,128,1},
+	    { 24,0x1,128,1}, { 31,0x1,128,1}, { 41,0x1,128,1}, { 56,0x3,128,1},
+	    {  3,0x1,130,1}, {  6,0x1,130,1}, { 10,0x1,130,1}, { 15,0x1,130,1},
+	    { 24,0x1,130,1}, { 31,0x1,130,1}, { 41,0x1,130,1}, { 56,0x3,130,1},
+	},
+	/* state 101 */
+	{
+	    {  1,0x1,131,3}, { 22,0x3,131,3}, {  1,0x1,162,3}, { 22,0x3,162,3},
+	    {  1,0x1,184,3}, { 22,0x3,184,3}, {  1,0x1,194,3}, { 22,0x3,194,3},
+	    {  1,0x1,224,3}, { 22,0x3,224,3}, {  1,0x1,226,3}, { 22,0x3,226,3},
+	    {  0,0x3,153,4}, {  0,0x3,161,4}, {  0,0x3,167,4}, {  0,0x3,172,4},
+	},
+	/* state 102 */
+	{
+	    {  2,0x1,131,2}, {  9,0x1,131,2}, { 23,0x1,131,2}, { 40,0x3,131,2},
+	    {  2,0x1,162,2}, {  9,0x1,162,2}, { 23,0x1,162,2}, { 40,0x3,162,2},
+	    {  2,0x1,184,2}, {  9,0x1,184,2}, { 23,0x1,184,2}, { 40,0x3,184,2},
+	    {  2,0x1,194,2}, {  9,0x1,194,2}, { 23,0x1,194,2}, { 40,0x3,194,2},
+	},
+	/* state 103 */
+	{
+	    {  3,0x1,131,1}, {  6,0x1,131,1}, { 10,0x1,131,1}, { 15,0x1,131,1},
+	    { 24,0x1,131,1}, { 31,0x1,131,1}, { 41,0x1,131,1}, { 56,0x3,131,1},
+	    {  3,0x1,162,1}, {  6,0x1,162,1}, { 10,0x1,162,1}, { 15,0x1,162,1},
+	    { 24,0x1,162,1}, { 31,0x1,162,1}, { 41,0x1,162,1}, { 56,0x3,162,1},
+	},
+	/* state 104 */
+	{
+	    {  3,0x1,184,1}, {  6,0x1,184,1}, { 10,0x1,184,1}, { 15,0x1,184,1},
+	    { 24,0x1,184,1}, { 31,0x1,184,1}, { 41,0x1,184,1}, { 56,0x3,184,1},
+	    {  3,0x1,194,1}, {  6,0x1,194,1}, { 10,0x1,194,1}, { 15,0x1,194,1},
+	    { 24,0x1,194,1}, { 31,0x1,194,1}, { 41,0x1,194,1}, { 56,0x3,194,1},
+	},
+	/* state 105 */
+	{
+	    {  2,0x1,224,2}, {  9,0x1,224,2}, { 23,0x1,224,2}, { 40,0x3,224,2},
+	    {  2,0x1,226,2}, {  9,0x1,226,2}, { 23,0x1,226,2}, { 40,0x3,226,2},
+	    {  1,0x1,153,3}, { 22,0x3,153,3}, {  1,0x1,161,3}, { 22,0x3,161,3},
+	    {  1,0x1,167,3}, { 22,0x3,167,3}, {  1,0x1,172,3}, { 22,0x3,172,3},
+	},
+	/* state 106 */
+	{
+	    {  3,0x1,224,1}, {  6,0x1,224,1}, { 10,0x1,224,1}, { 15,0x1,224,1},
+	    { 24,0x1,224,1}, { 31,0x1,224,1}, { 41,0x1,224,1}, { 56,0x3,224,1},
+	    {  3,0x1,226,1}, {  6,0x1,226,1}, { 10,0x1,226,1}, { 15,0x1,226,1},
+	    { 24,0x1,226,1}, { 31,0x1,226,1}, { 41,0x1,226,1}, { 56,0x3,226,1},
+	},
+	/* state 107 */
+	{
+	    {  2,0x1,153,2}, {  9,0x1,153,2}, { 23,0x1,153,2}, { 40,0x3,153,2},
+	    {  2,0x1,161,2}, {  9,0x1,161,2}, { 23,0x1,161,2}, { 40,0x3,161,2},
+	    {  2,0x1,167,2}, {  9,0x1,167,2}, { 23,0x1,167,2}, { 40,0x3,167,2},
+	    {  2,0x1,172,2}, {  9,0x1,172,2}, { 23,0x1,172,2}, { 40,0x3,172,2},
+	},
+	/* state 108 */
+	{
+	    {  3,0x1,153,1}, {  6,0x1,153,1}, { 10,0x1,153,1}, { 15,0x1,153,1},
+	    { 24,0x1,153,1}, { 31,0x1,153,1}, { 41,0x1,153,1}, { 56,0x3,153,1},
+	    {  3,0x1,161,1}, {  6,0x1,161,1}, { 10,0x1,161,1}, { 15,0x1,161,1},
+	    { 24,0x1,161,1}, { 31,0x1,161,1}, { 41,0x1,161,1}, { 56,0x3,161,1},
+	},
+	/* state 109 */
+	{
+	    {  3,0x1,167,1}, {  6,0x1,167,1}, { 10,0x1,167,1}, { 15,0x1,167,1},
+	    { 24,0x1,167,1}, { 31,0x1,167,1}, { 41,0x1,167,1}, { 56,0x3,167,1},
+	    {  3,0x1,172,1}, {  6,0x1,172,1}, { 10,0x1,172,1}, { 15,0x1,172,1},
+	    { 24,0x1,172,1}, { 31,0x1,172,1}, { 41,0x1,172,1}, { 56,0x3,172,1},
+	},
+	/* state 110 */
+	{
+	    {114,0x0,  0,0}, {115,0x0,  0,0}, {117,0x0,  0,0}, {118,0x0,  0,0},
+	    {121,0x0,  0,0}, {123,0x0,  0,0}, {127,0x0,  0,0}, {130,0x0,  0,0},
+	    {136,0x0,  0,0}, {139,0x0,  0,0}, {143,0x0,  0,0}, {146,0x0,  0,0},
+	    {155,0x0,  0,0}, {162,0x0,  0,0}, {170,0x0,  0,0}, {180,0x0,  0,0},
+	},
+	/* state 111 */
+	{
+	    {  0,0x3,176,4}, {  0,0x3,177,4}, {  0,0x3,179,4}, {  0,0x3,209,4},
+	    {  0,0x3,216,4}, {  0,0x3,217,4}, {  0,0x3,227,4}, {  0,0x3,229,4},
+	    {  0,0x3,230,4}, {122,0x0,  0,0}, {124,0x0,  0,0}, {125,0x0,  0,0},
+	    {128,0x0,  0,0}, {129,0x0,  0,0}, {131,0x0,  0,0}, {132,0x0,  0,0},
+	},
+	/* state 112 */
+	{
+	    {  1,0x1,176,3}, { 22,0x3,176,3}, {  1,0x1,177,3}, { 22,0x3,177,3},
+	    {  1,0x1,179,3}, { 22,0x3,179,3}, {  1,0x1,209,3}, { 22,0x3,209,3},
+	    {  1,0x1,216,3}, { 22,0x3,216,3}, {  1,0x1,217,3}, { 22,0x3,217,3},
+	    {  1,0x1,227,3}, { 22,0x3,227,3}, {  1,0x1,229,3}, { 22,0x3,229,3},
+	},
+	/* state 113 */
+	{
+	    {  2,0x1,176,2}, {  9,0x1,176,2}, { 23,0x1,176,2}, { 40,0x3,176,2},
+	    {  2,0x1,177,2}, {  9,0x1,177,2}, { 23,0x1,177,2}, { 40,0x3,177,2},
+	    {  2,0x1,179,2}, {  9,0x1,179,2}, { 23,0x1,179,2}, { 40,0x3,179,2},
+	    {  2,0x1,209,2}, {  9,0x1,209,2}, { 23,0x1,209,2}, { 40,0x3,209,2},
+	},
+	/* state 114 */
+	{
+	    {  3,0x1,176,1}, {  6,0x1,176,1}, { 10,0x1,176,1}, { 15,0x1,176,1},
+	    { 24,0x1,176,1}, { 31,0x1,176,1}, { 41,0x1,176,1}, { 56,0x3,176,1},
+	    {  3,0x1,177,1}, {  6,0x1,177,1}, { 10,0x1,177,1}, { 15,0x1,177,1},
+	    { 24,0x1,177,1}, { 31,0x1,177,1}, { 41,0x1,177,1}, { 56,0x3,177,1},
+	},
+	/* state 115 */
+	{
+	    {  3,0x1,179,1}, {  6,0x1,179,1}, { 10,0x1,179,1}, { 15,0x1,179,1},
+	    { 24,0x1,179,1}, { 31,0x1,179,1}, { 41,0x1,179,1}, { 56,0x3,179,1},
+	    {  3,0x1,209,1}, {  6,0x1,209,1}, { 10,0x1,209,1}, { 15,0x1,209,1},
+	    { 24,0x1,209,1}, { 31,0x1,209,1}, { 41,0x1,209,1}, { 56,0x3,209,1},
+	},
+	/* state 116 */
+	{
+	    {  2,0x1,216,2}, {  9,0x1,216,2}, { 23,0x1,216,2}, { 40,0x3,216,2},
+	    {  2,0x1,217,2}, {  9,0x1,217,2}, { 23,0x1,217,2}, { 40,0x3,217,2},
+	    {  2,0x1,227,2}, {  9,0x1,227,2}, { 23,0x1,227,2}, { 40,0x3,227,2},
+	    {  2,0x1,229,2}, {  9,0x1,229,2}, { 23,0x1,229,2}, { 40,0x3,229,2},
+	},
+	/* state 117 */
+	{
+	    {  3,0x1,216,1}, {  6,0x1,216,1}, { 10,0x1,216,1}, { 15,0x1,216,1},
+	    { 24,0x1,216,1}, { 31,0x1,216,1}, { 41,0x1,216,1}, { 56,0x3,216,1},
+	    {  3,0x1,217,1}, {  6,0x1,217,1}, { 10,0x1,217,1}, { 15,0x1,217,1},
+	    { 24,0x1,217,1}, { 31,0x1,217,1}, { 41,0x1,217,1}, { 56,0x3,217,1},
+	},
+	/* state 118 */
+	{
+	    {  3,0x1,227,1}, {  6,0x1,227,1}, { 10,0x1,227,1}, { 15,0x1,227,1},
+	    { 24,0x1,227,1}, { 31,0x1,227,1}, { 41,0x1,227,1}, { 56,0x3,227,1},
+	    {  3,0x1,229,1}, {  6,0x1,229,1}, { 10,0x1,229,1}, { 15,0x1,229,1},
+	    { 24,0x1,229,1}, { 31,0x1,229,1}, { 41,0x1,229,1}, { 56,0x3,229,1},
+	},
+	/* state 119 */
+	{
+	    {  1,0x1,230,3}, { 22,0x3,230,3}, {  0,0x3,129,4}, {  0,0x3,132,4},
+	    {  0,0x3,133,4}, {  0,0x3,134,4}, {  0,0x3,136,4}, {  0,0x3,146,4},
+	    {  0,0x3,154,4}, {  0,0x3,156,4}, {  0,0x3,160,4}, {  0,0x3,163,4},
+	    {  0,0x3,164,4}, {  0,0x3,169,4}, {  0,0x3,170,4}, {  0,0x3,173,4},
+	},
+	/* state 120 */
+	{
+	    {  2,0x1,230,2}, {  9,0x1,230,2}, { 23,0x1,230,2}, { 40,0x3,230,2},
+	    {  1,0x1,129,3}, { 22,0x3,129,3}, {  1,0x1,132,3}, { 22,0x3,132,3},
+	    {  1,0x1,133,3}, { 22,0x3,133,3}, {  1,0x1,134,3}, { 22,0x3,134,3},
+	    {  1,0x1,136,3}, { 22,0x3,136,3}, {  1,0x1,146,3}, { 22,0x3,146,3},
+	},
+	/* state 121 */
+	{
+	    {  3,0x1,230,1}, {  6,0x1,230,1}, { 10,0x1,230,1}, { 15,0x1,230,1},
+	    { 24,0x1,230,1}, { 31,0x1,230,1}, { 41,0x1,230,1}, { 56,0x3,230,1},
+	    {  2,0x1,129,2}, {  9,0x1,129,2}, { 23,0x1,129,2}, { 40,0x3,129,2},
+	    {  2,0x1,132,2}, {  9,0x1,132,2}, { 23,0x1,132,2}, { 40,0x3,132,2},
+	},
+	/* state 122 */
+	{
+	    {  3,0x1,129,1}, {  6,0x1,129,1}, { 10,0x1,129,1}, { 15,0x1,129,1},
+	    { 24,0x1,129,1}, { 31,0x1,129,1}, { 41,0x1,129,1}, { 56,0x3,129,1},
+	    {  3,0x1,132,1}, {  6,0x1,132,1}, { 10,0x1,132,1}, { 15,0x1,132,1},
+	    { 24,0x1,132,1}, { 31,0x1,132,1}, { 41,0x1,132,1}, { 56,0x3,132,1},
+	},
+	/* state 123 */
+	{
+	    {  2,0x1,133,2}, {  9,0x1,133,2}, { 23,0x1,133,2}, { 40,0x3,133,2},
+	    {  2,0x1,134,2}, {  9,0x1,134,2}, { 23,0x1,134,2}, { 40,0x3,134,2},
+	    {  2,0x1,136,2}, {  9,0x1,136,2}, { 23,0x1,136,2}, { 40,0x3,136,2},
+	    {  2,0x1,146,2}, {  9,0x1,146,2}, { 23,0x1,146,2}, { 40,0x3,146,2},
+	},
+	/* state 124 */
+	{
+	    {  3,0x1,133,1}, {  6,0x1,133,1}, { 10,0x1,133,1}, { 15,0x1,133,1},
+	    { 24,0x1,133,1}, { 31,0x1,133,1}, { 41,0x1,133,1}, { 56,0x3,133,1},
+	    {  3,0x1,134,1}, {  6,0x1,134,1}, { 10,0x1,134,1}, { 15,0x1,134,1},
+	    { 24,0x1,134,1}, { 31,0x1,134,1}, { 41,0x1,134,1}, { 56,0x3,134,1},
+	},
+	/* state 125 */
+	{
+	    {  3,0x1,136,1}, {  6,0x1,136,1}, { 10,0x1,136,1}, { 15,0x1,136,1},
+	    { 24,0x1,136,1}, { 31,0x1,136,1}, { 41,0x1,136,1}, { 56,0x3,136,1},
+	    {  3,0x1,146,1}, {  6,0x1,146,1}, { 10,0x1,146,1}, { 15,0x1,146,1},
+	    { 24,0x1,146,1}, { 31,0x1,146,1}, { 41,0x1,146,1}, { 56,0x3,146,1},
+	},
+	/* state 126 */
+	{
+	    {  1,0x1,154,3}, { 22,0x3,154,3}, {  1,0x1,156,3}, { 22,0x3,156,3},
+	    {  1,0x1,160,3}, { 22,0x3,160,3}, {  1,0x1,163,3}, { 22,0x3,163,3},
+	    {  1,0x1,164,3}, { 22,0x3,164,3}, {  1,0x1,169,3}, { 22,0x3,169,3},
+	    {  1,0x1,170,3}, { 22,0x3,170,3}, {  1,0x1,173,3}, { 22,0x3,173,3},
+	},
+	/* state 127 */
+	{
+	    {  2,0x1,154,2}, {  9,0x1,154,2}, { 23,0x1,154,2}, { 40,0x3,154,2},
+	    {  2,0x1,156,2}, {  9,0x1,156,2}, { 23,0x1,156,2}, { 40,0x3,156,2},
+	    {  2,0x1,160,2}, {  9,0x1,160,2}, { 23,0x1,160,2}, { 40,0x3,160,2},
+	    {  2,0x1,163,2}, {  9,0x1,163,2}, { 23,0x1,163,2}, { 40,0x3,163,2},
+	},
+	/* state 128 */
+	{
+	    {  3,0x1,154,1}, {  6,0x1,154,1}, { 10,0x1,154,1}, { 15,0x1,154,1},
+	    { 24,0x1,154,1}, { 31,0x1,154,1}, { 41,0x1,154,1}, { 56,0x3,154,1},
+	    {  3,0x1,156,1}, {  6,0x1,156,1}, { 10,0x1,156,1}, { 15,0x1,156,1},
+	    { 24,0x1,156,1}, { 31,0x1,156,1}, { 41,0x1,156,1}, { 56,0x3,156,1},
+	},
+	/* state 129 */
+	{
+	    {  3,0x1,160,1}, {  6,0x1,160,1}, { 10,0x1,160,1}, { 15,0x1,160,1},
+	    { 24,0x1,160,1}, { 31,0x1,160,1}, { 41,0x1,160,1}, { 56,0x3,160,1},
+	    {  3,0x1,163,1}, {  6,0x1,163,1}, { 10,0x1,163,1}, { 15,0x1,163,1},
+	    { 24,0x1,163,1}, { 31,0x1,163,1}, { 41,0x1,163,1}, { 56,0x3,163,1},
+	},
+	/* state 130 */
+	{
+	    {  2,0x1,164,2}, {  9,0x1,164,2}, { 23,0x1,164,2}, { 40,0x3,164,2},
+	    {  2,0x1,169,2}, {  9,0x1,169,2}, { 23,0x1,169,2}, { 40,0x3,169,2},
+	    {  2,0x1,170,2}, {  9,0x1,170,2}, { 23,0x1,170,2}, { 40,0x3,170,2},
+	    {  2,0x1,173,2}, {  9,0x1,173,2}, { 23,0x1,173,2}, { 40,0x3,173,2},
+	},
+	/* state 131 */
+	{
+	    {  3,0x1,164,1}, {  6,0x1,164,1}, { 10,0x1,164,1}, { 15,0x1,164,1},
+	    { 24,0x1,164,1}, { 31,0x1,164,1}, { 41,0x1,164,1}, { 56,0x3,164,1},
+	    {  3,0x1,169,1}, {  6,0x1,169,1}, { 10,0x1,169,1}, { 15,0x1,169,1},
+	    { 24,0x1,169,1}, { 31,0x1,169,1}, { 41,0x1,169,1}, { 56,0x3,169,1},
+	},
+	/* state 132 */
+	{
+	    {  3,0x1,170,1}, {  6,0x1,170,1}, { 10,0x1,170,1}, { 15,0x1,170,1},
+	    { 24,0x1,170,1}, { 31,0x1,170,1}, { 41,0x1,170,1}, { 56,0x3,170,1},
+	    {  3,0x1,173,1}, {  6,0x1,173,1}, { 10,0x1,173,1}, { 15,0x1,173,1},
+	    { 24,0x1,173,1}, { 31,0x1,173,1}, { 41,0x1,173,1}, { 56,0x3,173,1},
+	},
+	/* state 133 */
+	{
+	    {137,0x0,  0,0}, {138,0x0,  0,0}, {140,0x0,  0,0}, {141,0x0,  0,0},
+	    {144,0x0,  0,0}, {145,0x0,  0,0}, {147,0x0,  0,0}, {150,0x0,  0,0},
+	    {156,0x0,  0,0}, {159,0x0,  0,0}, {163,0x0,  0,0}, {166,0x0,  0,0},
+	    {171,0x0,  0,0}, {174,0x0,  0,0}, {181,0x0,  0,0}, {190,0x0,  0,0},
+	},
+	/* state 134 */
+	{
+	    {  0,0x3,178,4}, {  0,0x3,181,4}, {  0,0x3,185,4}, {  0,0x3,186,4},
+	    {  0,0x3,187,4}, {  0,0x3,189,4}, {  0,0x3,190,4}, {  0,0x3,196,4},
+	    {  0,0x3,198,4}, {  0,0x3,228,4}, {  0,0x3,232,4}, {  0,0x3,233,4},
+	    {148,0x0,  0,0}, {149,0x0,  0,0}, {151,0x0,  0,0}, {152,0x0,  0,0},
+	},
+	/* state 135 */
+	{
+	    {  1,0x1,178,3}, { 22,0x3,178,3}, {  1,0x1,181,3}, { 22,0x3,181,3},
+	    {  1,0x1,185,3}, { 22,0x3,185,3}, {  1,0x1,186,3}, { 22,0x3,186,3},
+	    {  1,0x1,187,3}, { 22,0x3,187,3}, {  1,0x1,189,3}, { 22,0x3,189,3},
+	    {  1,0x1,190,3}, { 22,0x3,190,3}, {  1,0x1,196,3}, { 22,0x3,196,3},
+	},
+	/* state 136 */
+	{
+	    {  2,0x1,178,2}, {  9,0x1,178,2}, { 23,0x1,178,2}, { 40,0x3,178,2},
+	    {  2,0x1,181,2}, {  9,0x1,181,2}, { 23,0x1,181,2}, { 40,0x3,181,2},
+	    {  2,0x1,185,2}, {  9,0x1,185,2}, { 23,0x1,185,2}, { 40,0x3,185,2},
+	    {  2,0x1,186,2}, {  9,0x1,186,2}, { 23,0x1,186,2}, { 40,0x3,186,2},
+	},
+	/* state 137 */
+	{
+	    {  3,0x1,178,1}, {  6,0x1,178,1}, { 10,0x1,178,1}, { 15,0x1,178,1},
+	    { 24,0x1,178,1}, { 31,0x1,178,1}, { 41,0x1,178,1}, { 56,0x3,178,1},
+	    {  3,0x1,181,1}, {  6,0x1,181,1}, { 10,0x1,181,1}, { 15,0x1,181,1},
+	    { 24,0x1,181,1}, { 31,0x1,181,1}, { 41,0x1,181,1}, { 56,0x3,181,1},
+	},
+	/* state 138 */
+	{
+	    {  3,0x1,185,1}, {  6,0x1,185,1}, { 10,0x1,185,1}, { 15,0x1,185,1},
+	    { 24,0x1,185,1}, { 31,0x1,185,1}, { 41,0x1,185,1}, { 56,0x3,185,1},
+	    {  3,0x1,186,1}, {  6,0x1,186,1}, { 10,0x1,186,1}, { 15,0x1,186,1},
+	    { 24,0x1,186,1}, { 31,0x1,186,1}, { 41,0x1,186,1}, { 56,0x3,186,1},
+	},
+	/* state 139 */
+	{
+	    {  2,0x1,187,2}, {  9,0x1,187,2}, { 23,0x1,187,2}, { 40,0x3,187,2},
+	    {  2,0x1,189,2}, {  9,0x1,189,2}, { 23,0x1,189,2}, { 40,0x3,189,2},
+	    {  2,0x1,190,2}, {  9,0x1,190,2}, { 23,0x1,190,2}, { 40,0x3,190,2},
+	    {  2,0x1,196,2}, {  9,0x1,196,2}, { 23,0x1,196,2}, { 40,0x3,196,2},
+	},
+	/* state 140 */
+	{
+	    {  3,0x1,187,1}, {  6,0x1,187,1}, { 10,0x1,187,1}, { 15,0x1,187,1},
+	    { 24,0x1,187,1}, { 31,0x1,187,1}, { 41,0x1,187,1}, { 56,0x3,187,1},
+	    {  3,0x1,189,1}, {  6,0x1,189,1}, { 10,0x1,189,1}, { 15,0x1,189,1},
+	    { 24,0x1,189,1}, { 31,0x1,189,1}, { 41,0x1,189,1}, { 56,0x3,189,1},
+	},
+	/* state 141 */
+	{
+	    {  3,0x1,190,1}, {  6,0x1,190,1}, { 10,0x1,190,1}, { 15,0x1,190,1},
+	    { 24,0x1,190,1}, { 31,0x1,190,1}, { 41,0x1,190,1}, { 56,0x3,190,1},
+	    {  3,0x1,196,1}, {  6,0x1,196,1}, { 10,0x1,196,1}, { 15,0x1,196,1},
+	    { 24,0x1,196,1}, { 31,0x1,196,1}, { 41,0x1,196,1}, { 56,0x3,196,1},
+	},
+	/* state 142 */
+	{
+	    {  1,0x1,198,3}, { 22,0x3,198,3}, {  1,0x1,228,3}, { 22,0x3,228,3},
+	    {  1,0x1,232,3}, { 22,0x3,232,3}, {  1,0x1,233,3}, { 22,0x3,233,3},
+	    {  0,0x3,  1,4}, {  0,0x3,135,4}, {  0,0x3,137,4}, {  0,0x3,138,4},
+	    {  0,0x3,139,4}, {  0,0x3,140,4}, {  0,0x3,141,4}, {  0,0x3,143,4},
+	},
+	/* state 143 */
+	{
+	    {  2,0x1,198,2}, {  9,0x1,198,2}, { 23,0x1,198,2}, { 40,0x3,198,2},
+	    {  2,0x1,228,2}, {  9,0x1,228,2}, { 23,0x1,228,2}, { 40,0x3,228,2},
+	    {  2,0x1,232,2}, {  9,0x1,232,2}, { 23,0x1,232,2}, { 40,0x3,232,2},
+	    {  2,0x1,233,2}, {  9,0x1,233,2}, { 23,0x1,233,2}, { 40,0x3,233,2},
+	},
+	/* state 144 */
+	{
+	    {  3,0x1,198,1}, {  6,0x1,198,1}, { 10,0x1,198,1}, { 15,0x1,198,1},
+	    { 24,0x1,198,1}, { 31,0x1,198,1}, { 41,0x1,198,1}, { 56,0x3,198,1},
+	    {  3,0x1,228,1}, {  6,0x1,228,1}, { 10,0x1,228,1}, { 15,0x1,228,1},
+	    { 24,0x1,228,1}, { 31,0x1,228,1}, { 41,0x1,228,1}, { 56,0x3,228,1},
+	},
+	/* state 145 */
+	{
+	    {  3,0x1,232,1}, {  6,0x1,232,1}, { 10,0x1,232,1}, { 15,0x1,232,1},
+	    { 24,0x1,232,1}, { 31,0x1,232,1}, { 41,0x1,232,1}, { 56,0x3,232,1},
+	    {  3,0x1,233,1}, {  6,0x1,233,1}, { 10,0x1,233,1}, { 15,0x1,233,1},
+	    { 24,0x1,233,1}, { 31,0x1,233,1}, { 41,0x1,233,1}, { 56,0x3,233,1},
+	},
+	/* state 146 */
+	{
+	    {  1,0x1,  1,3}, { 22,0x3,  1,3}, {  1,0x1,135,3}, { 22,0x3,135,3},
+	    {  1,0x1,137,3}, { 22,0x3,137,3}, {  1,0x1,138,3}, { 22,0x3,138,3},
+	    {  1,0x1,139,3}, { 22,0x3,139,3}, {  1,0x1,140,3}, { 22,0x3,140,3},
+	    {  1,0x1,141,3}, { 22,0x3,141,3}, {  1,0x1,143,3}, { 22,0x3,143,3},
+	},
+	/* state 147 */
+	{
+	    {  2,0x1,  1,2}, {  9,0x1,  1,2}, { 23,0x1,  1,2}, { 40,0x3,  1,2},
+	    {  2,0x1,135,2}, {  9,0x1,135,2}, { 23,0x1,135,2}, { 40,0x3,135,2},
+	    {  2,0x1,137,2}, {  9,0x1,137,2}, { 23,0x1,137,2}, { 40,0x3,137,2},
+	    {  2,0x1,138,2}, {  9,0x1,138,2}, { 23,0x1,138,2}, { 40,0x3,138,2},
+	},
+	/* state 148 */
+	{
+	    {  3,0x1,  1,1}, {  6,0x1,  1,1}, { 10,0x1,  1,1}, { 15,0x1,  1,1},
+	    { 24,0x1,  1,1}, { 31,0x1,  1,1}, { 41,0x1,  1,1}, { 56,0x3,  1,1},
+	    {  3,0x1,135,1}, {  6,0x1,135,1}, { 10,0x1,135,1}, { 15,0x1,135,1},
+	    { 24,0x1,135,1}, { 31,0x1,135,1}, { 41,0x1,135,1}, { 56,0x3,135,1},
+	},
+	/* state 149 */
+	{
+	    {  3,0x1,137,1}, {  6,0x1,137,1}, { 10,0x1,137,1}, { 15,0x1,137,1},
+	    { 24,0x1,137,1}, { 31,0x1,137,1}, { 41,0x1,137,1}, { 56,0x3,137,1},
+	    {  3,0x1,138,1}, {  6,0x1,138,1}, { 10,0x1,138,1}, { 15,0x1,138,1},
+	    { 24,0x1,138,1}, { 31,0x1,138,1}, { 41,0x1,138,1}, { 56,0x3,138,1},
+	},
+	/* state 150 */
+	{
+	    {  2,0x1,139,2}, {  9,0x1,139,2}, { 23,0x1,139,2}, { 40,0x3,139,2},
+	    {  2,0x1,140,2}, {  9,0x1,140,2}, { 23,0x1,140,2}, { 40,0x3,140,2},
+	    {  2,0x1,141,2}, {  9,0x1,141,2}, { 23,0x1,141,2}, { 40,0x3,141,2},
+	    {  2,0x1,143,2}, {  9,0x1,143,2}, { 23,0x1,143,2}, { 40,0x3,143,2},
+	},
+	/* state 151 */
+	{
+	    {  3,0x1,139,1}, {  6,0x1,139,1}, { 10,0x1,139,1}, { 15,0x1,139,1},
+	    { 24,0x1,139,1}, { 31,0x1,139,1}, { 41,0x1,139,1}, { 56,0x3,139,1},
+	    {  3,0x1,140,1}, {  6,0x1,140,1}, { 10,0x1,140,1}, { 15,0x1,140,1},
+	    { 24,0x1,140,1}, { 31,0x1,140,1}, { 41,0x1,140,1}, { 56,0x3,140,1},
+	},
+	/* state 152 */
+	{
+	    {  3,0x1,141,1}, {  6,0x1,141,1}, { 10,0x1,141,1}, { 15,0x1,141,1},
+	    { 24,0x1,141,1}, { 31,0x1,141,1}, { 41,0x1,141,1}, { 56,0x3,141,1},
+	    {  3,0x1,143,1}, {  6,0x1,143,1}, { 10,0x1,143,1}, { 15,0x1,143,1},
+	    { 24,0x1,143,1}, { 31,0x1,143,1}, { 41,0x1,143,1}, { 56,0x3,143,1},
+	},
+	/* state 153 */
+	{
+	    {157,0x0,  0,0}, {158,0x0,  0,0}, {160,0x0,  0,0}, {161,0x0,  0,0},
+	    {164,0x0,  0,0}, {165,0x0,  0,0}, {167,0x0,  0,0}, {168,0x0,  0,0},
+	    {172,0x0,  0,0}, {173,0x0,  0,0}, {175,0x0,  0,0}, {177,0x0,  0,0},
+	    {182,0x0,  0,0}, {185,0x0,  0,0}, {191,0x0,  0,0}, {207,0x0,  0,0},
+	},
+	/* state 154 */
+	{
+	    {  0,0x3,147,4}, {  0,0x3,149,4}, {  0,0x3,150,4}, {  0,0x3,151,4},
+	    {  0,0x3,152,4}, {  0,0x3,155,4}, {  0,0x3,157,4}, {  0,0x3,158,4},
+	    {  0,0x3,165,4}, {  0,0x3,166,4}, {  0,0x3,168,4}, {  0,0x3,174,4},
+	    {  0,0x3,175,4}, {  0,0x3,180,4}, {  0,0x3,182,4}, {  0,0x3,183,4},
+	},
+	/* state 155 */
+	{
+	    {  1,0x1,147,3}, { 22,0x3,147,3}, {  1,0x1,149,3}, { 22,0x3,149,3},
+	    {  1,0x1,150,3}, { 22,0x3,150,3}, {  1,0x1,151,3}, { 22,0x3,151,3},
+	    {  1,0x1,152,3}, { 22,0x3,152,3}, {  1,0x1,155,3}, { 22,0x3,155,3},
+	    {  1,0x1,157,3}, { 22,0x3,157,3}, {  1,0x1,158,3}, { 22,0x3,158,3},
+	},
+	/* state 156 */
+	{
+	    {  2,0x1,147,2}, {  9,0x1,147,2}, { 23,0x1,147,2}, { 40,0x3,147,2},
+	    {  2,0x1,149,2}, {  9,0x1,149,2}, { 23,0x1,149,2}, { 40,0x3,149,2},
+	    {  2,0x1,150,2}, {  9,0x1,150,2}, { 23,0x1,150,2}, { 40,0x3,150,2},
+	    {  2,0x1,151,2}, {  9,0x1,151,2}, { 23,0x1,151,2}, { 40,0x3,151,2},
+	},
+	/* state 157 */
+	{
+	    {  3,0x1,147,1}, {  6,0x1,147,1}, { 10,0x1,147,1}, { 15,0x1,147,1},
+	    { 24,0x1,147,1}, { 31,0x1,147,1}, { 41,0x1,147,1}, { 56,0x3,147,1},
+	    {  3,0x1,149,1}, {  6,0x1,149,1}, { 10,0x1,149,1}, { 15,0x1,149,1},
+	    { 24,0x1,149,1}, { 31,0x1,149,1}, { 41,0x1,149,1}, { 56,0x3,149,1},
+	},
+	/* state 158 */
+	{
+	    {  3,0x1,150,1}, {  6,0x1,150,1}, { 10,0x1,150,1}, { 15,0x1,150,1},
+	    { 24,0x1,150,1}, { 31,0x1,150,1}, { 41,0x1,150,1}, { 56,0x3,150,1},
+	    {  3,0x1,151,1}, {  6,0x1,151,1}, { 10,0x1,151,1}, { 15,0x1,151,1},
+	    { 24,0x1,151,1}, { 31,0x1,151,1}, { 41,0x1,151,1}, { 56,0x3,151,1},
+	},
+	/* state 159 */
+	{
+	    {  2,0x1,152,2}, {  9,0x1,152,2}, { 23,0x1,152,2}, { 40,0x3,152,2},
+	    {  2,0x1,155,2}, {  9,0x1,155,2}, { 23,0x1,155,2}, { 40,0x3,155,2},
+	    {  2,0x1,157,2}, {  9,0x1,157,2}, { 23,0x1,157,2}, { 40,0x3,157,2},
+	    {  2,0x1,158,2}, {  9,0x1,158,2}, { 23,0x1,158,2}, { 40,0x3,158,2},
+	},
+	/* state 160 */
+	{
+	    {  3,0x1,152,1}, {  6,0x1,152,1}, { 10,0x1,152,1}, { 15,0x1,152,1},
+	    { 24,0x1,152,1}, { 31,0x1,152,1}, { 41,0x1,152,1}, { 56,0x3,152,1},
+	    {  3,0x1,155,1}, {  6,0x1,155,1}, { 10,0x1,155,1}, { 15,0x1,155,1},
+	    { 24,0x1,155,1}, { 31,0x1,155,1}, { 41,0x1,155,1}, { 56,0x3,155,1},
+	},
+	/* state 161 */
+	{
+	    {  3,0x1,157,1}, {  6,0x1,157,1}, { 10,0x1,157,1}, { 15,0x1,157,1},
+	    { 24,0x1,157,1}, { 31,0x1,157,1}, { 41,0x1,157,1}, { 56,0x3,157,1},
+	    {  3,0x1,158,1}, {  6,0x1,158,1}, { 10,0x1,158,1}, { 15,0x1,158,1},
+	    { 24,0x1,158,1}, { 31,0x1,158,1}, { 41,0x1,158,1}, { 56,0x3,158,1},
+	},
+	/* state 162 */
+	{
+	    {  1,0x1,165,3}, { 22,0x3,165,3}, {  1,0x1,166,3}, { 22,0x3,166,3},
+	    {  1,0x1,168,3}, { 22,0x3,168,3}, {  1,0x1,174,3}, { 22,0x3,174,3},
+	    {  1,0x1,175,3}, { 22,0x3,175,3}, {  1,0x1,180,3}, { 22,0x3,180,3},
+	    {  1,0x1,182,3}, { 22,0x3,182,3}, {  1,0x1,183,3}, { 22,0x3,183,3},
+	},
+	/* state 163 */
+	{
+	    {  2,0x1,165,2}, {  9,0x1,165,2}, { 23,0x1,165,2}, { 40,0x3,165,2},
+	    {  2,0x1,166,2}, {  9,0x1,166,2}, { 23,0x1,166,2}, { 40,0x3,166,2},
+	    {  2,0x1,168,2}, {  9,0x1,168,2}, { 23,0x1,168,2}, { 40,0x3,168,2},
+	    {  2,0x1,174,2}, {  9,0x1,174,2}, { 23,0x1,174,2}, { 40,0x3,174,2},
+	},
+	/* state 164 */
+	{
+	    {  3,0x1,165,1}, {  6,0x1,165,1}, { 10,0x1,165,1}, { 15,0x1,165,1},
+	    { 24,0x1,165,1}, { 31,0x1,165,1}, { 41,0x1,165,1}, { 56,0x3,165,1},
+	    {  3,0x1,166,1}, {  6,0x1,166,1}, { 10,0x1,166,1}, { 15,0x1,166,1},
+	    { 24,0x1,166,1}, { 31,0x1,166,1}, { 41,0x1,166,1}, { 56,0x3,166,1},
+	},
+	/* state 165 */
+	{
+	    {  3,0x1,168,1}, {  6,0x1,168,1}, { 10,0x1,168,1}, { 15,0x1,168,1},
+	    { 24,0x1,168,1}, { 31,0x1,168,1}, { 41,0x1,168,1}, { 56,0x3,168,1},
+	    {  3,0x1,174,1}, {  6,0x1,174,1}, { 10,0x1,174,1}, { 15,0x1,174,1},
+	    { 24,0x1,174,1}, { 31,0x1,174,1}, { 41,0x1,174,1}, { 56,0x3,174,1},
+	},
+	/* state 166 */
+	{
+	    {  2,0x1,175,2}, {  9,0x1,175,2}, { 23,0x1,175,2}, { 40,0x3,175,2},
+	    {  2,0x1,180,2}, {  9,0x1,180,2}, { 23,0x1,180,2}, { 40,0x3,180,2},
+	    {  2,0x1,182,2}, {  9,0x1,182,2}, { 23,0x1,182,2}, { 40,0x3,182,2},
+	    {  2,0x1,183,2}, {  9,0x1,183,2}, { 23,0x1,183,2}, { 40,0x3,183,2},
+	},
+	/* state 167 */
+	{
+	    {  3,0x1,175,1}, {  6,0x1,175,1}, { 10,0x1,175,1}, { 15,0x1,175,1},
+	    { 24,0x1,175,1}, { 31,0x1,175,1}, { 41,0x1,175,1}, { 56,0x3,175,1},
+	    {  3,0x1,180,1}, {  6,0x1,180,1}, { 10,0x1,180,1}, { 15,0x1,180,1},
+	    { 24,0x1,180,1}, { 31,0x1,180,1}, { 41,0x1,180,1}, { 56,0x3,180,1},
+	},
+	/* state 168 */
+	{
+	    {  3,0x1,182,1}, {  6,0x1,182,1}, { 10,0x1,182,1}, { 15,0x1,182,1},
+	    { 24,0x1,182,1}, { 31,0x1,182,1}, { 41,0x1,182,1}, { 56,0x3,182,1},
+	    {  3,0x1,183,1}, {  6,0x1,183,1}, { 10,0x1,183,1}, { 15,0x1,183,1},
+	    { 24,0x1,183,1}, { 31,0x1,183,1}, { 41,0x1,183,1}, { 56,0x3,183,1},
+	},
+	/* state 169 */
+	{
+	    {  0,0x3,188,4}, {  0,0x3,191,4}, {  0,0x3,197,4}, {  0,0x3,231,4},
+	    {  0,0x3,239,4}, {176,0x0,  0,0}, {178,0x0,  0,0}, {179,0x0,  0,0},
+	    {183,0x0,  0,0}, {184,0x0,  0,0}, {186,0x0,  0,0}, {187,0x0,  0,0},
+	    {192,0x0,  0,0}, {199,0x0,  0,0}, {208,0x0,  0,0}, {223,0x0,  0,0},
+	},
+	/* state 170 */
+	{
+	    {  1,0x1,188,3}, { 22,0x3,188,3}, {  1,0x1,191,3}, { 22,0x3,191,3},
+	    {  1,0x1,197,3}, { 22,0x3,197,3}, {  1,0x1,231,3}, { 22,0x3,231,3},
+	    {  1,0x1,239,3}, { 22,0x3,239,3}, {  0,0x3,  9,4}, {  0,0x3,142,4},
+	    {  0,0x3,144,4}, {  0,0x3,145,4}, {  0,0x3,148,4}, {  0,0x3,159,4},
+	},
+	/* state 171 */
+	{
+	    {  2,0x1,188,2}, {  9,0x1,188,2}, { 23,0x1,188,2}, { 40,0x3,188,2},
+	    {  2,0x1,191,2}, {  9,0x1,191,2}, { 23,0x1,191,2}, { 40,0x3,191,2},
+	    {  2,0x1,197,2}, {  9,0x1,197,2}, { 23,0x1,197,2}, { 40,0x3,197,2},
+	    {  2,0x1,231,2}, {  9,0x1,231,2}, { 23,0x1,231,2}, { 40,0x3,231,2},
+	},
+	/* state 172 */
+	{
+	    {  3,0x1,188,1}, {  6,0x1,188,1}, { 10,0x1,188,1}, { 15,0x1,188,1},
+	    { 24,0x1,188,1}, { 31,0x1,188,1}, { 41,0x1,188,1}, { 56,0x3,188,1},
+	    {  3,0x1,191,1}, {  6,0x1,191,1}, { 10,0x1,191,1}, { 15,0x1,191,1},
+	    { 24,0x1,191,1}, { 31,0x1,191,1}, { 41,0x1,191,1}, { 56,0x3,191,1},
+	},
+	/* state 173 */
+	{
+	    {  3,0x1,197,1}, {  6,0x1,197,1}, { 10,0x1,197,1}, { 15,0x1,197,1},
+	    { 24,0x1,197,1}, { 31,0x1,197,1}, { 41,0x1,197,1}, { 56,0x3,197,1},
+	    {  3,0x1,231,1}, {  6,0x1,231,1}, { 10,0x1,231,1}, { 15,0x1,231,1},
+	    { 24,0x1,231,1}, { 31,0x1,231,1}, { 41,0x1,231,1}, { 56,0x3,231,1},
+	},
+	/* state 174 */
+	{
+	    {  2,0x1,239,2}, {  9,0x1,239,2}, { 23,0x1,239,2}, { 40,0x3,239,2},
+	    {  1,0x1,  9,3}, { 22,0x3,  9,3}, {  1,0x1,142,3}, { 22,0x3,142,3},
+	    {  1,0x1,144,3}, { 22,0x3,144,3}, {  1,0x1,145,3}, { 22,0x3,145,3},
+	    {  1,0x1,148,3}, { 22,0x3,148,3}, {  1,0x1,159,3}, { 22,0x3,159,3},
+	},
+	/* state 175 */
+	{
+	    {  3,0x1,239,1}, {  6,0x1,239,1}, { 10,0x1,239,1}, { 15,0x1,239,1},
+	    { 24,0x1,239,1}, { 31,0x1,239,1}, { 41,0x1,239,1}, { 56,0x3,239,1},
+	    {  2,0x1,  9,2}, {  9,0x1,  9,2}, { 23,0x1,  9,2}, { 40,0x3,  9,2},
+	    {  2,0x1,142,2}, {  9,0x1,142,2}, { 23,0x1,142,2}, { 40,0x3,142,2},
+	},
+	/* state 176 */
+	{
+	    {  3,0x1,  9,1}, {  6,0x1,  9,1}, { 10,0x1,  9,1}, { 15,0x1,  9,1},
+	    { 24,0x1,  9,1}, { 31,0x1,  9,1}, { 41,0x1,  9,1}, { 56,0x3,  9,1},
+	    {  3,0x1,142,1}, {  6,0x1,142,1}, { 10,0x1,142,1}, { 15,0x1,142,1},
+	    { 24,0x1,142,1}, { 31,0x1,142,1}, { 41,0x1,142,1}, { 56,0x3,142,1},
+	},
+	/* state 177 */
+	{
+	    {  2,0x1,144,2}, {  9,0x1,144,2}, { 23,0x1,144,2}, { 40,0x3,144,2},
+	    {  2,0x1,145,2}, {  9,0x1,145,2}, { 23,0x1,145,2}, { 40,0x3,145,2},
+	    {  2,0x1,148,2}, {  9,0x1,148,2}, { 23,0x1,148,2}, { 40,0x3,148,2},
+	    {  2,0x1,159,2}, {  9,0x1,159,2}, { 23,0x1,159,2}, { 40,0x3,159,2},
+	},
+	/* state 178 */
+	{
+	    {  3,0x1,144,1}, {  6,0x1,144,1}, { 10,0x1,144,1}, { 15,0x1,144,1},
+	    { 24,0x1,144,1}, { 31,0x1,144,1}, { 41,0x1,144,1}, { 56,0x3,144,1},
+	    {  3,0x1,145,1}, {  6,0x1,145,1}, { 10,0x1,145,1}, { 15,0x1,145,1},
+	    { 24,0x1,145,1}, { 31,0x1,145,1}, { 41,0x1,145,1}, { 56,0x3,145,1},
+	},
+	/* state 179 */
+	{
+	    {  3,0x1,148,1}, {  6,0x1,148,1}, { 10,0x1,148,1}, { 15,0x1,148,1},
+	    { 24,0x1,148,1}, { 31,0x1,148,1}, { 41,0x1,148,1}, { 56,0x3,148,1},
+	    {  3,0x1,159,1}, {  6,0x1,159,1}, { 10,0x1,159,1}, { 15,0x1,159,1},
+	    { 24,0x1,159,1}, { 31,0x1,159,1}, { 41,0x1,159,1}, { 56,0x3,159,1},
+	},
+	/* state 180 */
+	{
+	    {  0,0x3,171,4}, {  0,0x3,206,4}, {  0,0x3,215,4}, {  0,0x3,225,4},
+	    {  0,0x3,236,4}, {  0,0x3,237,4}, {188,0x0,  0,0}, {189,0x0,  0,0},
+	    {193,0x0,  0,0}, {196,0x0,  0,0}, {200,0x0,  0,0}, {203,0x0,  0,0},
+	    {209,0x0,  0,0}, {216,0x0,  0,0}, {224,0x0,  0,0}, {238,0x0,  0,0},
+	},
+	/* state 181 */
+	{
+	    {  1,0x1,171,3}, { 22,0x3,171,3}, {  1,0x1,206,3}, { 22,0x3,206,3},
+	    {  1,0x1,215,3}, { 22,0x3,215,3}, {  1,0x1,225,3}, { 22,0x3,225,3},
+	    {  1,0x1,236,3}, { 22,0x3,236,3}, {  1,0x1,237,3}, { 22,0x3,237,3},
+	    {  0,0x3,199,4}, {  0,0x3,207,4}, {  0,0x3,234,4}, {  0,0x3,235,4},
+	},
+	/* state 182 */
+	{
+	    {  2,0x1,171,2}, {  9,0x1,171,2}, { 23,0x1,171,2}, { 40,0x3,171,2},
+	    {  2,0x1,206,2}, {  9,0x1,206,2}, { 23,0x1,206,2}, { 40,0x3,206,2},
+	    {  2,0x1,215,2}, {  9,0x1,215,2}, { 23,0x1,215,2}, { 40,0x3,215,2},
+	    {  2,0x1,225,2}, {  9,0x1,225,2}, { 23,0x1,225,2}, { 40,0x3,225,2},
+	},
+	/* state 183 */
+	{
+	    {  3,0x1,171,1}, {  6,0x1,171,1}, { 10,0x1,171,1}, { 15,0x1,171,1},
+	    { 24,0x1,171,1}, { 31,0x1,171,1}, { 41,0x1,171,1}, { 56,0x3,171,1},
+	    {  3,0x1,206,1}, {  6,0x1,206,1}, { 10,0x1,206,1}, { 15,0x1,206,1},
+	    { 24,0x1,206,1}, { 31,0x1,206,1}, { 41,0x1,206,1}, { 56,0x3,206,1},
+	},
+	/* state 184 */
+	{
+	    {  3,0x1,215,1}, {  6,0x1,215,1}, { 10,0x1,215,1}, { 15,0x1,215,1},
+	    { 24,0x1,215,1}, { 31,0x1,215,1}, { 41,0x1,215,1}, { 56,0x3,215,1},
+	    {  3,0x1,225,1}, {  6,0x1,225,1}, { 10,0x1,225,1}, { 15,0x1,225,1},
+	    { 24,0x1,225,1}, { 31,0x1,225,1}, { 41,0x1,225,1}, { 56,0x3,225,1},
+	},
+	/* state 185 */
+	{
+	    {  2,0x1,236,2}, {  9,0x1,236,2}, { 23,0x1,236,2}, { 40,0x3,236,2},
+	    {  2,0x1,237,2}, {  9,0x1,237,2}, { 23,0x1,237,2}, { 40,0x3,237,2},
+	    {  1,0x1,199,3}, { 22,0x3,199,3}, {  1,0x1,207,3}, { 22,0x3,207,3},
+	    {  1,0x1,234,3}, { 22,0x3,234,3}, {  1,0x1,235,3}, { 22,0x3,235,3},
+	},
+	/* state 186 */
+	{
+	    {  3,0x1,236,1}, {  6,0x1,236,1}, { 10,0x1,236,1}, { 15,0x1,236,1},
+	    { 24,0x1,236,1}, { 31,0x1,236,1}, { 41,0x1,236,1}, { 56,0x3,236,1},
+	    {  3,0x1,237,1}, {  6,0x1,237,1}, { 10,0x1,237,1}, { 15,0x1,237,1},
+	    { 24,0x1,237,1}, { 31,0x1,237,1}, { 41,0x1,237,1}, { 56,0x3,237,1},
+	},
+	/* state 187 */
+	{
+	    {  2,0x1,199,2}, {  9,0x1,199,2}, { 23,0x1,199,2}, { 40,0x3,199,2},
+	    {  2,0x1,207,2}, {  9,0x1,207,2}, { 23,0x1,207,2}, { 40,0x3,207,2},
+	    {  2,0x1,234,2}, {  9,0x1,234,2}, { 23,0x1,234,2}, { 40,0x3,234,2},
+	    {  2,0x1,235,2}, {  9,0x1,235,2}, { 23,0x1,235,2}, { 40,0x3,235,2},
+	},
+	/* state 188 */
+	{
+	    {  3,0x1,199,1}, {  6,0x1,199,1}, { 10,0x1,199,1}, { 15,0x1,199,1},
+	    { 24,0x1,199,1}, { 31,0x1,199,1}, { 41,0x1,199,1}, { 56,0x3,199,1},
+	    {  3,0x1,207,1}, {  6,0x1,207,1}, { 10,0x1,207,1}, { 15,0x1,207,1},
+	    { 24,0x1,207,1}, { 31,0x1,207,1}, { 41,0x1,207,1}, { 56,0x3,207,1},
+	},
+	/* state 189 */
+	{
+	    {  3,0x1,234,1}, {  6,0x1,234,1}, { 10,0x1,234,1}, { 15,0x1,234,1},
+	    { 24,0x1,234,1}, { 31,0x1,234,1}, { 41,0x1,234,1}, { 56,0x3,234,1},
+	    {  3,0x1,235,1}, {  6,0x1,235,1}, { 10,0x1,235,1}, { 15,0x1,235,1},
+	    { 24,0x1,235,1}, { 31,0x1,235,1}, { 41,0x1,235,1}, { 56,0x3,235,1},
+	},
+	/* state 190 */
+	{
+	    {194,0x0,  0,0}, {195,0x0,  0,0}, {197,0x0,  0,0}, {198,0x0,  0,0},
+	    {201,0x0,  0,0}, {202,0x0,  0,0}, {204,0x0,  0,0}, {205,0x0,  0,0},
+	    {210,0x0,  0,0}, {213,0x0,  0,0}, {217,0x0,  0,0}, {220,0x0,  0,0},
+	    {225,0x0,  0,0}, {231,0x0,  0,0}, {239,0x0,  0,0}, {246,0x0,  0,0},
+	},
+	/* state 191 */
+	{
+	    {  0,0x3,192,4}, {  0,0x3,193,4}, {  0,0x3,200,4}, {  0,0x3,201,4},
+	    {  0,0x3,202,4}, {  0,0x3,205,4}, {  0,0x3,210,4}, {  0,0x3,213,4},
+	    {  0,0x3,218,4}, {  0,0x3,219,4}, {  0,0x3,238,4}, {  0,0x3,240,4},
+	    {  0,0x3,242,4}, {  0,0x3,243,4}, {  0,0x3,255,4}, {206,0x0,  0,0},
+	},
+	/* state 192 */
+	{
+	    {  1,0x1,192,3}, { 22,0x3,192,3}, {  1,0x1,193,3}, { 22,0x3,193,3},
+	    {  1,0x1,200,3}, { 22,0x3,200,3}, {  1,0x1,201,3}, { 22,0x3,201,3},
+	    {  1,0x1,202,3}, { 22,0x3,202,3}, {  1,0x1,205,3}, { 22,0x3,205,3},
+	    {  1,0x1,210,3}, { 22,0x3,210,3}, {  1,0x1,213,3}, { 22,0x3,213,3},
+	},
+	/* state 193 */
+	{
+	    {  2,0x1,192,2}, {  9,0x1,192,2}, { 23,0x1,192,2}, { 40,0x3,192,2},
+	    {  2,0x1,193,2}, {  9,0x1,193,2}, { 23,0x1,193,2}, { 40,0x3,193,2},
+	    {  2,0x1,200,2}, {  9,0x1,200,2}, { 23,0x1,200,2}, { 40,0x3,200,2},
+	    {  2,0x1,201,2}, {  9,0x1,201,2}, { 23,0x1,201,2}, { 40,0x3,201,2},
+	},
+	/* state 194 */
+	{
+	    {  3,0x1,192,1}, {  6,0x1,192,1}, { 10,0x1,192,1}, { 15,0x1,192,1},
+	    { 24,0x1,192,1}, { 31,0x1,192,1}, { 41,0x1,192,1}, { 56,0x3,192,1},
+	    {  3,0x1,193,1}, {  6,0x1,193,1}, { 10,0x1,193,1}, { 15,0x1,193,1},
+	    { 24,0x1,193,1}, { 31,0x1,193,1}, { 41,0x1,193,1}, { 56,0x3,193,1},
+	},
+	/* state 195 */
+	{
+	    {  3,0x1,200,1}, {  6,0x1,200,1}, { 10,0x1,200,1}, { 15,0x1,200,1},
+	    { 24,0x1,200,1}, { 31,0x1,200,1}, { 41,0x1,200,1}, { 56,0x3,200,1},
+	    {  3,0x1,201,1}, {  6,0x1,201,1}, { 10,0x1,201,1}, { 15,0x1,201,1},
+	    { 24,0x1,201,1}, { 31,0x1,201,1}, { 41,0x1,201,1}, { 56,0x3,201,1},
+	},
+	/* state 196 */
+	{
+	    {  2,0x1,202,2}, {  9,0x1,202,2}, { 23,0x1,202,2}, { 40,0x3,202,2},
+	    {  2,0x1,205,2}, {  9,0x1,205,2}, { 23,0x1,205,2}, { 40,0x3,205,2},
+	    {  2,0x1,210,2}, {  9,0x1,210,2}, { 23,0x1,210,2}, { 40,0x3,210,2},
+	    {  2,0x1,213,2}, {  9,0x1,213,2}, { 23,0x1,213,2}, { 40,0x3,213,2},
+	},
+	/* state 197 */
+	{
+	    {  3,0x1,202,1}, {  6,0x1,202,1}, { 10,0x1,202,1}, { 15,0x1,202,1},
+	    { 24,0x1,202,1}, { 31,0x1,202,1}, { 41,0x1,202,1}, { 56,0x3,202,1},
+	    {  3,0x1,205,1}, {  6,0x1,205,1}, { 10,0x1,205,1}, { 15,0x1,205,1},
+	    { 24,0x1,205,1}, { 31,0x1,205,1}, { 41,0x1,205,1}, { 56,0x3,205,1},
+	},
+	/* state 198 */
+	{
+	    {  3,0x1,210,1}, {  6,0x1,210,1}, { 10,0x1,210,1}, { 15,0x1,210,1},
+	    { 24,0x1,210,1}, { 31,0x1,210,1}, { 41,0x1,210,1}, { 56,0x3,210,1},
+	    {  3,0x1,213,1}, {  6,0x1,213,1}, { 10,0x1,213,1}, { 15,0x1,213,1},
+	    { 24,0x1,213,1}, { 31,0x1,213,1}, { 41,0x1,213,1}, { 56,0x3,213,1},
+	},
+	/* state 199 */
+	{
+	    {  1,0x1,218,3}, { 22,0x3,218,3}, {  1,0x1,219,3}, { 22,0x3,219,3},
+	    {  1,0x1,238,3}, { 22,0x3,238,3}, {  1,0x1,240,3}, { 22,0x3,240,3},
+	    {  1,0x1,242,3}, { 22,0x3,242,3}, {  1,0x1,243,3}, { 22,0x3,243,3},
+	    {  1,0x1,255,3}, { 22,0x3,255,3}, {  0,0x3,203,4}, {  0,0x3,204,4},
+	},
+	/* state 200 */
+	{
+	    {  2,0x1,218,2}, {  9,0x1,218,2}, { 23,0x1,218,2}, { 40,0x3,218,2},
+	    {  2,0x1,219,2}, {  9,0x1,219,2}, { 23,0x1,219,2}, { 40,0x3,219,2},
+	    {  2,0x1,238,2}, {  9,0x1,238,2}, { 23,0x1,238,2}, { 40,0x3,238,2},
+	    {  2,0x1,240,2}, {  9,0x1,240,2}, { 23,0x1,240,2}, { 40,0x3,240,2},
+	},
+	/* state 201 */
+	{
+	    {  3,0x1,218,1}, {  6,0x1,218,1}, { 10,0x1,218,1}, { 15,0x1,218,1},
+	    { 24,0x1,218,1}, { 31,0x1,218,1}, { 41,0x1,218,1}, { 56,0x3,218,1},
+	    {  3,0x1,219,1}, {  6,0x1,219,1}, { 10,0x1,219,1}, { 15,0x1,219,1},
+	    { 24,0x1,219,1}, { 31,0x1,219,1}, { 41,0x1,219,1}, { 56,0x3,219,1},
+	},
+	/* state 202 */
+	{
+	    {  3,0x1,238,1}, {  6,0x1,238,1}, { 10,0x1,238,1}, { 15,0x1,238,1},
+	    { 24,0x1,238,1}, { 31,0x1,238,1}, { 41,0x1,238,1}, { 56,0x3,238,1},
+	    {  3,0x1,240,1}, {  6,0x1,240,1}, { 10,0x1,240,1}, { 15,0x1,240,1},
+	    { 24,0x1,240,1}, { 31,0x1,240,1}, { 41,0x1,240,1}, { 56,0x3,240,1},
+	},
+	/* state 203 */
+	{
+	    {  2,0x1,242,2}, {  9,0x1,242,2}, { 23,0x1,242,2}, { 40,0x3,242,2},
+	    {  2,0x1,243,2}, {  9,0x1,243,2}, { 23,0x1,243,2}, { 40,0x3,243,2},
+	    {  2,0x1,255,2}, {  9,0x1,255,2}, { 23,0x1,255,2}, { 40,0x3,255,2},
+	    {  1,0x1,203,3}, { 22,0x3,203,3}, {  1,0x1,204,3}, { 22,0x3,204,3},
+	},
+	/* state 204 */
+	{
+	    {  3,0x1,242,1}, {  6,0x1,242,1}, { 10,0x1,242,1}, { 15,0x1,242,1},
+	    { 24,0x1,242,1}, { 31,0x1,242,1}, { 41,0x1,242,1}, { 56,0x3,242,1},
+	    {  3,0x1,243,1}, {  6,0x1,243,1}, { 10,0x1,243,1}, { 15,0x1,243,1},
+	    { 24,0x1,243,1}, { 31,0x1,243,1}, { 41,0x1,243,1}, { 56,0x3,243,1},
+	},
+	/* state 205 */
+	{
+	    {  3,0x1,255,1}, {  6,0x1,255,1}, { 10,0x1,255,1}, { 15,0x1,255,1},
+	    { 24,0x1,255,1}, { 31,0x1,255,1}, { 41,0x1,255,1}, { 56,0x3,255,1},
+	    {  2,0x1,203,2}, {  9,0x1,203,2}, { 23,0x1,203,2}, { 40,0x3,203,2},
+	    {  2,0x1,204,2}, {  9,0x1,204,2}, { 23,0x1,204,2}, { 40,0x3,204,2},
+	},
+	/* state 206 */
+	{
+	    {  3,0x1,203,1}, {  6,0x1,203,1}, { 10,0x1,203,1}, { 15,0x1,203,1},
+	    { 24,0x1,203,1}, { 31,0x1,203,1}, { 41,0x1,203,1}, { 56,0x3,203,1},
+	    {  3,0x1,204,1}, {  6,0x1,204,1}, { 10,0x1,204,1}, { 15,0x1,204,1},
+	    { 24,0x1,204,1}, { 31,0x1,204,1}, { 41,0x1,204,1}, { 56,0x3,204,1},
+	},
+	/* state 207 */
+	{
+	    {211,0x0,  0,0}, {212,0x0,  0,0}, {214,0x0,  0,0}, {215,0x0,  0,0},
+	    {218,0x0,  0,0}, {219,0x0,  0,0}, {221,0x0,  0,0}, {222,0x0,  0,0},
+	    {226,0x0,  0,0}, {228,0x0,  0,0}, {232,0x0,  0,0}, {235,0x0,  0,0},
+	    {240,0x0,  0,0}, {243,0x0,  0,0}, {247,0x0,  0,0}, {250,0x0,  0,0},
+	},
+	/* state 208 */
+	{
+	    {  0,0x3,211,4}, {  0,0x3,212,4}, {  0,0x3,214,4}, {  0,0x3,221,4},
+	    {  0,0x3,222,4}, {  0,0x3,223,4}, {  0,0x3,241,4}, {  0,0x3,244,4},
+	    {  0,0x3,245,4}, {  0,0x3,246,4}, {  0,0x3,247,4}, {  0,0x3,248,4},
+	    {  0,0x3,250,4}, {  0,0x3,251,4}, {  0,0x3,252,4}, {  0,0x3,253,4},
+	},
+	/* state 209 */
+	{
+	    {  1,0x1,211,3}, { 22,0x3,211,3}, {  1,0x1,212,3}, { 22,0x3,212,3},
+	    {  1,0x1,214,3}, { 22,0x3,214,3}, {  1,0x1,221,3}, { 22,0x3,221,3},
+	    {  1,0x1,222,3}, { 22,0x3,222,3}, {  1,0x1,223,3}, { 22,0x3,223,3},
+	    {  1,0x1,241,3}, { 22,0x3,241,3}, {  1,0x1,244,3}, { 22,0x3,244,3},
+	},
+	/* state 210 */
+	{
+	    {  2,0x1,211,2}, {  9,0x1,211,2}, { 23,0x1,211,2}, { 40,0x3,211,2},
+	    {  2,0x1,212,2}, {  9,0x1,212,2}, { 23,0x1,212,2}, { 40,0x3,212,2},
+	    {  2,0x1,214,2}, {  9,0x1,214,2}, { 23,0x1,214,2}, { 40,0x3,214,2},
+	    {  2,0x1,221,2}, {  9,0x1,221,2}, { 23,0x1,221,2}, { 40,0x3,221,2},
+	},
+	/* state 211 */
+	{
+	    {  3,0x1,211,1}, {  6,0x1,211,1}, { 10,0x1,211,1}, { 15,0x1,211,1},
+	    { 24,0x1,211,1}, { 31,0x1,211,1}, { 41,0x1,211,1}, { 56,0x3,211,1},
+	    {  3,0x1,212,1}, {  6,0x1,212,1}, { 10,0x1,212,1}, { 15,0x1,212,1},
+	    { 24,0x1,212,1}, { 31,0x1,212,1}, { 41,0x1,212,1}, { 56,0x3,212,1},
+	},
+	/* state 212 */
+	{
+	    {  3,0x1,214,1}, {  6,0x1,214,1}, { 10,0x1,214,1}, { 15,0x1,214,1},
+	    { 24,0x1,214,1}, { 31,0x1,214,1}, { 41,0x1,214,1}, { 56,0x3,214,1},
+	    {  3,0x1,221,1}, {  6,0x1,221,1}, { 10,0x1,221,1}, { 15,0x1,221,1},
+	    { 24,0x1,221,1}, { 31,0x1,221,1}, { 41,0x1,221,1}, { 56,0x3,221,1},
+	},
+	/* state 213 */
+	{
+	    {  2,0x1,222,2}, {  9,0x1,222,2}, { 23,0x1,222,2}, { 40,0x3,222,2},
+	    {  2,0x1,223,2}, {  9,0x1,223,2}, { 23,0x1,223,2}, { 40,0x3,223,2},
+	    {  2,0x1,241,2}, {  9,0x1,241,2}, { 23,0x1,241,2}, { 40,0x3,241,2},
+	    {  2,0x1,244,2}, {  9,0x1,244,2}, { 23,0x1,244,2}, { 40,0x3,244,2},
+	},
+	/* state 214 */
+	{
+	    {  3,0x1,222,1}, {  6,0x1,222,1}, { 10,0x1,222,1}, { 15,0x1,222,1},
+	    { 24,0x1,222,1}, { 31,0x1,222,1}, { 41,0x1,222,1}, { 56,0x3,222,1},
+	    {  3,0x1,223,1}, {  6,0x1,223,1}, { 10,0x1,223,1}, { 15,0x1,223,1},
+	    { 24,0x1,223,1}, { 31,0x1,223,1}, { 41,0x1,223,1}, { 56,0x3,223,1},
+	},
+	/* state 215 */
+	{
+	    {  3,0x1,241,1}, {  6,0x1,241,1}, { 10,0x1,241,1}, { 15,0x1,241,1},
+	    { 24,0x1,241,1}, { 31,0x1,241,1}, { 41,0x1,241,1}, { 56,0x3,241,1},
+	    {  3,0x1,244,1}, {  6,0x1,244,1}, { 10,0x1,244,1}, { 15,0x1,244,1},
+	    { 24,0x1,244,1}, { 31,0x1,244,1}, { 41,0x1,244,1}, { 56,0x3,244,1},
+	},
+	/* state 216 */
+	{
+	    {  1,0x1,245,3}, { 22,0x3,245,3}, {  1,0x1,246,3}, { 22,0x3,246,3},
+	    {  1,0x1,247,3}, { 22,0x3,247,3}, {  1,0x1,248,3}, { 22,0x3,248,3},
+	    {  1,0x1,250,3}, { 22,0x3,250,3}, {  1,0x1,251,3}, { 22,0x3,251,3},
+	    {  1,0x1,252,3}, { 22,0x3,252,3}, {  1,0x1,253,3}, { 22,0x3,253,3},
+	},
+	/* state 217 */
+	{
+	    {  2,0x1,245,2}, {  9,0x1,245,2}, { 23,0x1,245,2}, { 40,0x3,245,2},
+	    {  2,0x1,246,2}, {  9,0x1,246,2}, { 23,0x1,246,2}, { 40,0x3,246,2},
+	    {  2,0x1,247,2}, {  9,0x1,247,2}, { 23,0x1,247,2}, { 40,0x3,247,2},
+	    {  2,0x1,248,2}, {  9,0x1,248,2}, { 23,0x1,248,2}, { 40,0x3,248,2},
+	},
+	/* state 218 */
+	{
+	    {  3,0x1,245,1}, {  6,0x1,245,1}, { 10,0x1,245,1}, { 15,0x1,245,1},
+	    { 24,0x1,245,1}, { 31,0x1,245,1}, { 41,0x1,245,1}, { 56,0x3,245,1},
+	    {  3,0x1,246,1}, {  6,0x1,246,1}, { 10,0x1,246,1}, { 15,0x1,246,1},
+	    { 24,0x1,246,1}, { 31,0x1,246,1}, { 41,0x1,246,1}, { 56,0x3,246,1},
+	},
+	/* state 219 */
+	{
+	    {  3,0x1,247,1}, {  6,0x1,247,1}, { 10,0x1,247,1}, { 15,0x1,247,1},
+	    { 24,0x1,247,1}, { 31,0x1,247,1}, { 41,0x1,247,1}, { 56,0x3,247,1},
+	    {  3,0x1,248,1}, {  6,0x1,248,1}, { 10,0x1,248,1}, { 15,0x1,248,1},
+	    { 24,0x1,248,1}, { 31,0x1,248,1}, { 41,0x1,248,1}, { 56,0x3,248,1},
+	},
+	/* state 220 */
+	{
+	    {  2,0x1,250,2}, {  9,0x1,250,2}, { 23,0x1,250,2}, { 40,0x3,250,2},
+	    {  2,0x1,251,2}, {  9,0x1,251,2}, { 23,0x1,251,2}, { 40,0x3,251,2},
+	    {  2,0x1,252,2}, {  9,0x1,252,2}, { 23,0x1,252,2}, { 40,0x3,252,2},
+	    {  2,0x1,253,2}, {  9,0x1,253,2}, { 23,0x1,253,2}, { 40,0x3,253,2},
+	},
+	/* state 221 */
+	{
+	    {  3,0x1,250,1}, {  6,0x1,250,1}, { 10,0x1,250,1}, { 15,0x1,250,1},
+	    { 24,0x1,250,1}, { 31,0x1,250,1}, { 41,0x1,250,1}, { 56,0x3,250,1},
+	    {  3,0x1,251,1}, {  6,0x1,251,1}, { 10,0x1,251,1}, { 15,0x1,251,1},
+	    { 24,0x1,251,1}, { 31,0x1,251,1}, { 41,0x1,251,1}, { 56,0x3,251,1},
+	},
+	/* state 222 */
+	{
+	    {  3,0x1,252,1}, {  6,0x1,252,1}, { 10,0x1,252,1}, { 15,0x1,252,1},
+	    { 24,0x1,252,1}, { 31,0x1,252,1}, { 41,0x1,252,1}, { 56,0x3,252,1},
+	    {  3,0x1,253,1}, {  6,0x1,253,1}, { 10,0x1,253,1}, { 15,0x1,253,1},
+	    { 24,0x1,253,1}, { 31,0x1,253,1}, { 41,0x1,253,1}, { 56,0x3,253,1},
+	},
+	/* state 223 */
+	{
+	    {  0,0x3,254,4}, {227,0x0,  0,0}, {229,0x0,  0,0}, {230,0x0,  0,0},
+	    {233,0x0,  0,0}, {234,0x0,  0,0}, {236,0x0,  0,0}, {237,0x0,  0,0},
+	    {241,0x0,  0,0}, {242,0x0,  0,0}, {244,0x0,  0,0}, {245,0x0,  0,0},
+	    {248,0x0,  0,0}, {249,0x0,  0,0}, {251,0x0,  0,0}, {252,0x0,  0,0},
+	},
+	/* state 224 */
+	{
+	    {  1,0x1,254,3}, { 22,0x3,254,3}, {  0,0x3,  2,4}, {  0,0x3,  3,4},
+	    {  0,0x3,  4,4}, {  0,0x3,  5,4}, {  0,0x3,  6,4}, {  0,0x3,  7,4},
+	    {  0,0x3,  8,4}, {  0,0x3, 11,4}, {  0,0x3, 12,4}, {  0,0x3, 14,4},
+	    {  0,0x3, 15,4}, {  0,0x3, 16,4}, {  0,0x3, 17,4}, {  0,0x3, 18,4},
+	},
+	/* state 225 */
+	{
+	    {  2,0x1,254,2}, {  9,0x1,254,2}, { 23,0x1,254,2}, { 40,0x3,254,2},
+	    {  1,0x1,  2,3}, { 22,0x3,  2,3}, {  1,0x1,  3,3}, { 22,0x3,  3,3},
+	    {  1,0x1,  4,3}, { 22,0x3,  4,3}, {  1,0x1,  5,3}, { 22,0x3,  5,3},
+	    {  1,0x1,  6,3}, { 22,0x3,  6,3}, {  1,0x1,  7,3}, { 22,0x3,  7,3},
+	},
+	/* state 226 */
+	{
+	    {  3,0x1,254,1}, {  6,0x1,254,1}, { 10,0x1,254,1}, { 15,0x1,254,1},
+	    { 24,0x1,254,1}, { 31,0x1,254,1}, { 41,0x1,254,1}, { 56,0x3,254,1},
+	    {  2,0x1,  2,2}, {  9,0x1,  2,2}, { 23,0x1,  2,2}, { 40,0x3,  2,2},
+	    {  2,0x1,  3,2}, {  9,0x1,  3,2}, { 23,0x1,  3,2}, { 40,0x3,  3,2},
+	},
+	/* state 227 */
+	{
+	    {  3,0x1,  2,1}, {  6,0x1,  2,1}, { 10,0x1,  2,1}, { 15,0x1,  2,1},
+	    { 24,0x1,  2,1}, { 31,0x1,  2,1}, { 41,0x1,  2,1}, { 56,0x3,  2,1},
+	    {  3,0x1,  3,1}, {  6,0x1,  3,1}, { 10,0x1,  3,1}, { 15,0x1,  3,1},
+	    { 24,0x1,  3,1}, { 31,0x1,  3,1}, { 41,0x1,  3,1}, { 56,0x3,  3,1},
+	},
+	/* state 228 */
+	{
+	    {  2,0x1,  4,2}, {  9,0x1,  4,2}, { 23,0x1,  4,2}, { 40,0x3,  4,2},
+	    {  2,0x1,  5,2}, {  9,0x1,  5,2}, { 23,0x1,  5,2}, { 40,0x3,  5,2},
+	    {  2,0x1,  6,2}, {  9,0x1,  6,2}, { 23,0x1,  6,2}, { 40,0x3,  6,2},
+	    {  2,0x1,  7,2}, {  9,0x1,  7,2}, { 23,0x1,  7,2}, { 40,0x3,  7,2},
+	},
+	/* state 229 */
+	{
+	    {  3,0x1,  4,1}, {  6,0x1,  4,1}, { 10,0x1,  4,1}, { 15,0x1,  4,1},
+	    { 24,0x1,  4,1}, { 31,0x1,  4,1}, { 41,0x1,  4,1}, { 56,0x3,  4,1},
+	    {  3,0x1,  5,1}, {  6,0x1,  5,1}, { 10,0x1,  5,1}, { 15,0x1,  5,1},
+	    { 24,0x1,  5,1}, { 31,0x1,  5,1}, { 41,0x1,  5,1}, { 56,0x3,  5,1},
+	},
+	/* state 230 */
+	{
+	    {  3,0x1,  6,1}, {  6,0x1,  6,1}, { 10,0x1,  6,1}, { 15,0x1,  6,1},
+	    { 24,0x1,  6,1}, { 31,0x1,  6,1}, { 41,0x1,  6,1}, { 56,0x3,  6,1},
+	    {  3,0x1,  7,1}, {  6,0x1,  7,1}, { 10,0x1,  7,1}, { 15,0x1,  7,1},
+	    { 24,0x1,  7,1}, { 31,0x1,  7,1}, { 41,0x1,  7,1}, { 56,0x3,  7,1},
+	},
+	/* state 231 */
+	{
+	    {  1,0x1,  8,3}, { 22,0x3,  8,3}, {  1,0x1, 11,3}, { 22,0x3, 11,3},
+	    {  1,0x1, 12,3}, { 22,0x3, 12,3}, {  1,0x1, 14,3}, { 22,0x3, 14,3},
+	    {  1,0x1, 15,3}, { 22,0x3, 15,3}, {  1,0x1, 16,3}, { 22,0x3, 16,3},
+	    {  1,0x1, 17,3}, { 22,0x3, 17,3}, {  1,0x1, 18,3}, { 22,0x3, 18,3},
+	},
+	/* state 232 */
+	{
+	    {  2,0x1,  8,2}, {  9,0x1,  8,2}, { 23,0x1,  8,2}, { 40,0x3,  8,2},
+	    {  2,0x1, 11,2}, {  9,0x1, 11,2}, { 23,0x1, 11,2}, { 40,0x3, 11,2},
+	    {  2,0x1, 12,2}, {  9,0x1, 12,2}, { 23,0x1, 12,2}, { 40,0x3, 12,2},
+	    {  2,0x1, 14,2}, {  9,0x1, 14,2}, { 23,0x1, 14,2}, { 40,0x3, 14,2},
+	},
+	/* state 233 */
+	{
+	    {  3,0x1,  8,1}, {  6,0x1,  8,1}, { 10,0x1,  8,1}, { 15,0x1,  8,1},
+	    { 24,0x1,  8,1}, { 31,0x1,  8,1}, { 41,0x1,  8,1}, { 56,0x3,  8,1},
+	    {  3,0x1, 11,1}, {  6,0x1, 11,1}, { 10,0x1, 11,1}, { 15,0x1, 11,1},
+	    { 24,0x1, 11,1}, { 31,0x1, 11,1}, { 41,0x1, 11,1}, { 56,0x3, 11,1},
+	},
+	/* state 234 */
+	{
+	    {  3,0x1, 12,1}, {  6,0x1, 12,1}, { 10,0x1, 12,1}, { 15,0x1, 12,1},
+	    { 24,0x1, 12,1}, { 31,0x1, 12,1}, { 41,0x1, 12,1}, { 56,0x3, 12,1},
+	    {  3,0x1, 14,1}, {  6,0x1, 14,1}, { 10,0x1, 14,1}, { 15,0x1, 14,1},
+	    { 24,0x1, 14,1}, { 31,0x1, 14,1}, { 41,0x1, 14,1}, { 56,0x3, 14,1},
+	},
+	/* state 235 */
+	{
+	    {  2,0x1, 15,2}, {  9,0x1, 15,2}, { 23,0x1, 15,2}, { 40,0x3, 15,2},
+	    {  2,0x1, 16,2}, {  9,0x1, 16,2}, { 23,0x1, 16,2}, { 40,0x3, 16,2},
+	    {  2,0x1, 17,2}, {  9,0x1, 17,2}, { 23,0x1, 17,2}, { 40,0x3, 17,2},
+	    {  2,0x1, 18,2}, {  9,0x1, 18,2}, { 23,0x1, 18,2}, { 40,0x3, 18,2},
+	},
+	/* state 236 */
+	{
+	    {  3,0x1, 15,1}, {  6,0x1, 15,1}, { 10,0x1, 15,1}, { 15,0x1, 15,1},
+	    { 24,0x1, 15,1}, { 31,0x1, 15,1}, { 41,0x1, 15,1}, { 56,0x3, 15,1},
+	    {  3,0x1, 16,1}, {  6,0x1, 16,1}, { 10,0x1, 16,1}, { 15,0x1, 16,1},
+	    { 24,0x1, 16,1}, { 31,0x1, 16,1}, { 41,0x1, 16,1}, { 56,0x3, 16,1},
+	},
+	/* state 237 */
+	{
+	    {  3,0x1, 17,1}, {  6,0x1, 17,1}, { 10,0x1, 17,1}, { 15,0x1, 17,1},
+	    { 24,0x1, 17,1}, { 31,0x1, 17,1}, { 41,0x1, 17,1}, { 56,0x3, 17,1},
+	    {  3,0x1, 18,1}, {  6,0x1, 18,1}, { 10,0x1, 18,1}, { 15,0x1, 18,1},
+	    { 24,0x1, 18,1}, { 31,0x1, 18,1}, { 41,0x1, 18,1}, { 56,0x3, 18,1},
+	},
+	/* state 238 */
+	{
+	    {  0,0x3, 19,4}, {  0,0x3, 20,4}, {  0,0x3, 21,4}, {  0,0x3, 23,4},
+	    {  0,0x3, 24,4}, {  0,0x3, 25,4}, {  0,0x3, 26,4}, {  0,0x3, 27,4},
+	    {  0,0x3, 28,4}, {  0,0x3, 29,4}, {  0,0x3, 30,4}, {  0,0x3, 31,4},
+	    {  0,0x3,127,4}, {  0,0x3,220,4}, {  0,0x3,249,4}, {253,0x0,  0,0},
+	},
+	/* state 239 */
+	{
+	    {  1,0x1, 19,3}, { 22,0x3, 19,3}, {  1,0x1, 20,3}, { 22,0x3, 20,3},
+	    {  1,0x1, 21,3}, { 22,0x3, 21,3}, {  1,0x1, 23,3}, { 22,0x3, 23,3},
+	    {  1,0x1, 24,3}, { 22,0x3, 24,3}, {  1,0x1, 25,3}, { 22,0x3, 25,3},
+	    {  1,0x1, 26,3}, { 22,0x3, 26,3}, {  1,0x1, 27,3}, { 22,0x3, 27,3},
+	},
+	/* state 240 */
+	{
+	    {  2,0x1, 19,2}, {  9,0x1, 19,2}, { 23,0x1, 19,2}, { 40,0x3, 19,2},
+	    {  2,0x1, 20,2}, {  9,0x1, 20,2}, { 23,0x1, 20,2}, { 40,0x3, 20,2},
+	    {  2,0x1, 21,2}, {  9,0x1, 21,2}, { 23,0x1, 21,2}, { 40,0x3, 21,2},
+	    {  2,0x1, 23,2}, {  9,0x1, 23,2}, { 23,0x1, 23,2}, { 40,0x3, 23,2},
+	},
+	/* state 241 */
+	{
+	    {  3,0x1, 19,1}, {  6,0x1, 19,1}, { 10,0x1, 19,1}, { 15,0x1, 19,1},
+	    { 24,0x1, 19,1}, { 31,0x1, 19,1}, { 41,0x1, 19,1}, { 56,0x3, 19,1},
+	    {  3,0x1, 20,1}, {  6,0x1, 20,1}, { 10,0x1, 20,1}, { 15,0x1, 20,1},
+	    { 24,0x1, 20,1}, { 31,0x1, 20,1}, { 41,0x1, 20,1}, { 56,0x3, 20,1},
+	},
+	/* state 242 */
+	{
+	    {  3,0x1, 21,1}, {  6,0x1, 21,1}, { 10,0x1, 21,1}, { 15,0x1, 21,1},
+	    { 24,0x1, 21,1}, { 31,0x1, 21,1}, { 41,0x1, 21,1}, { 56,0x3, 21,1},
+	    {  3,0x1, 23,1}, {  6,0x1, 23,1}, { 10,0x1, 23,1}, { 15,0x1, 23,1},
+	    { 24,0x1, 23,1}, { 31,0x1, 23,1}, { 41,0x1, 23,1}, { 56,0x3, 23,1},
+	},
+	/* state 243 */
+	{
+	    {  2,0x1, 24,2}, {  9,0x1, 24,2}, { 23,0x1, 24,2}, { 40,0x3, 24,2},
+	    {  2,0x1, 25,2}, {  9,0x1, 25,2}, { 23,0x1, 25,2}, { 40,0x3, 25,2},
+	    {  2,0x1, 26,2}, {  9,0x1, 26,2}, { 23,0x1, 26,2}, { 40,0x3, 26,2},
+	    {  2,0x1, 27,2}, {  9,0x1, 27,2}, { 23,0x1, 27,2}, { 40,0x3, 27,2},
+	},
+	/* state 244 */
+	{
+	    {  3,0x1, 24,1}, {  6,0x1, 24,1}, { 10,0x1, 24,1}, { 15,0x1, 24,1},
+	    { 24,0x1, 24,1}, { 31,0x1, 24,1}, { 41,0x1, 24,1}, { 56,0x3, 24,1},
+	    {  3,0x1, 25,1}, {  6,0x1, 25,1}, { 10,0x1, 25,1}, { 15,0x1, 25,1},
+	    { 24,0x1, 25,1}, { 31,0x1, 25,1}, { 41,0x1, 25,1}, { 56,0x3, 25,1},
+	},
+	/* state 245 */
+	{
+	    {  3,0x1, 26,1}, {  6,0x1, 26,1}, { 10,0x1, 26,1}, { 15,0x1, 26,1},
+	    { 24,0x1, 26,1}, { 31,0x1, 26,1}, { 41,0x1, 26,1}, { 56,0x3, 26,1},
+	    {  3,0x1, 27,1}, {  6,0x1, 27,1}, { 10,0x1, 27,1}, { 15,0x1, 27,1},
+	    { 24,0x1, 27,1}, { 31,0x1, 27,1}, { 41,0x1, 27,1}, { 56,0x3, 27,1},
+	},
+	/* state 246 */
+	{
+	    {  1,0x1, 28,3}, { 22,0x3, 28,3}, {  1,0x1, 29,3}, { 22,0x3, 29,3},
+	    {  1,0x1, 30,3}, { 22,0x3, 30,3}, {  1,0x1, 31,3}, { 22,0x3, 31,3},
+	    {  1,0x1,127,3}, { 22,0x3,127,3}, {  1,0x1,220,3}, { 22,0x3,220,3},
+	    {  1,0x1,249,3}, { 22,0x3,249,3}, {254,0x0,  0,0}, {255,0x0,  0,0},
+	},
+	/* state 247 */
+	{
+	    {  2,0x1, 28,2}, {  9,0x1, 28,2}, { 23,0x1, 28,2}, { 40,0x3, 28,2},
+	    {  2,0x1, 29,2}, {  9,0x1, 29,2}, { 23,0x1, 29,2}, { 40,0x3, 29,2},
+	    {  2,0x1, 30,2}, {  9,0x1, 30,2}, { 23,0x1, 30,2}, { 40,0x3, 30,2},
+	    {  2,0x1, 31,2}, {  9,0x1, 31,2}, { 23,0x1, 31,2}, { 40,0x3, 31,2},
+	},
+	/* state 248 */
+	{
+	    {  3,0x1, 28,1}, {  6,0x1, 28,1}, { 10,0x1, 28,1}, { 15,0x1, 28,1},
+	    { 24,0x1, 28,1}, { 31,0x1, 28,1}, { 41,0x1, 28,1}, { 56,0x3, 28,1},
+	    {  3,0x1, 29,1}, {  6,0x1, 29,1}, { 10,0x1, 29,1}, { 15,0x1, 29,1},
+	    { 24,0x1, 29,1}, { 31,0x1, 29,1}, { 41,0x1, 29,1}, { 56,0x3, 29,1},
+	},
+	/* state 249 */
+	{
+	    {  3,0x1, 30,1}, {  6,0x1, 30,1}, { 10,0x1, 30,1}, { 15,0x1, 30,1},
+	    { 24,0x1, 30,1}, { 31,0x1, 30,1}, { 41,0x1, 30,1}, { 56,0x3, 30,1},
+	    {  3,0x1, 31,1}, {  6,0x1, 31,1}, { 10,0x1, 31,1}, { 15,0x1, 31,1},
+	    { 24,0x1, 31,1}, { 31,0x1, 31,1}, { 41,0x1, 31,1}, { 56,0x3, 31,1},
+	},
+	/* state 250 */
+	{
+	    {  2,0x1,127,2}, {  9,0x1,127,2}, { 23,0x1,127,2}, { 40,0x3,127,2},
+	    {  2,0x1,220,2}, {  9,0x1,220,2}, { 23,0x1,220,2}, { 40,0x3,220,2},
+	    {  2,0x1,249,2}, {  9,0x1,249,2}, { 23,0x1,249,2}, { 40,0x3,249,2},
+	    {  0,0x3, 10,4}, {  0,0x3, 13,4}, {  0,0x3, 22,4}, {  0,0x4,  0,0},
+	},
+	/* state 251 */
+	{
+	    {  3,0x1,127,1}, {  6,0x1,127,1}, { 10,0x1,127,1}, { 15,0x1,127,1},
+	    { 24,0x1,127,1}, { 31,0x1,127,1}, { 41,0x1,127,1}, { 56,0x3,127,1},
+	    {  3,0x1,220,1}, {  6,0x1,220,1}, { 10,0x1,220,1}, { 15,0x1,220,1},
+	    { 24,0x1,220,1}, { 31,0x1,220,1}, { 41,0x1,220,1}, { 56,0x3,220,1},
+	},
+	/* state 252 */
+	{
+	    {  3,0x1,249,1}, {  6,0x1,249,1}, { 10,0x1,249,1}, { 15,0x1,249,1},
+	    { 24,0x1,249,1}, { 31,0x1,249,1}, { 41,0x1,249,1}, { 56,0x3,249,1},
+	    {  1,0x1, 10,3}, { 22,0x3, 10,3}, {  1,0x1, 13,3}, { 22,0x3, 13,3},
+	    {  1,0x1, 22,3}, { 22,0x3, 22,3}, {  0,0x4,  0,0}, {  0,0x4,  0,0},
+	},
+	/* state 253 */
+	{
+	    {  2,0x1, 10,2}, {  9,0x1, 10,2}, { 23,0x1, 10,2}, { 40,0x3, 10,2},
+	    {  2,0x1, 13,2}, {  9,0x1, 13,2}, { 23,0x1, 13,2}, { 40,0x3, 13,2},
+	    {  2,0x1, 22,2}, {  9,0x1, 22,2}, { 23,0x1, 22,2}, { 40,0x3, 22,2},
+	    {  0,0x4,  0,0}, {  0,0x4,  0,0}, {  0,0x4,  0,0}, {  0,0x4,  0,0},
+	},
+	/* state 254 */
+	{
+	    {  3,0x1, 10,1}, {  6,0x1, 10,1}, { 10,0x1, 10,1}, { 15,0x1, 10,1},
+	    { 24,0x1, 10,1}, { 31,0x1, 10,1}, { 41,0x1, 10,1}, { 56,0x3, 10,1},
+	    {  3,0x1, 13,1}, {  6,0x1, 13,1}, { 10,0x1, 13,1}, { 15,0x1, 13,1},
+	    { 24,0x1, 13,1}, { 31,0x1, 13,1}, { 41,0x1, 13,1}, { 56,0x3, 13,1},
+	},
+	/* state 255 */
+	{
+	    {  3,0x1, 22,1}, {  6,0x1, 22,1}, { 10,0x1, 22,1}, { 15,0x1, 22,1},
+	    { 24,0x1, 22,1}, { 31,0x1, 22,1}, { 41,0x1, 22,1}, { 56,0x3, 22,1},
+	    {  0,0x4,  0,0}, {  0,0x4,  0,0}, {  0,0x4,  0,0}, {  0,0x4,  0,0},
+	    {  0,0x4,  0,0}, {  0,0x4,  0,0}, {  0,0x4,  0,0}, {  0,0x4,  0,0},
+	},
+};
+
+static const struct hpack_huffman_fast
+    huffman_decode_fast[1 << HPACK_HUFFMAN_FAST_BITS] = {
+	{{ 48, 48},{ 5,10}}, {{ 48, 48},{ 5,10}}, {{ 48, 48},{ 5,10}},
+	{{ 48, 48},{ 5,10}}, {{ 48, 49},{ 5,10}}, {{ 48, 49},{ 5,10}},
+	{{ 48, 49},{ 5,10}}, {{ 48, 49},{ 5,10}}, {{ 48, 50},{ 5,10}},
+	{{ 48, 50},{ 5,10}}, {{ 48, 50},{ 5,10}}, {{ 48, 50},{ 5,10}},
+	{{ 48, 97},{ 5,10}}, {{ 48, 97},{ 5,10}}, {{ 48, 97},{ 5,10}},
+	{{ 48, 97},{ 5,10}}, {{ 48, 99},{ 5,10}}, {{ 48, 99},{ 5,10}},
+	{{ 48, 99},{ 5,10}}, {{ 48, 99},{ 5,10}}, {{ 48,101},{ 5,10}},
+	{{ 48,101},{ 5,10}}, {{ 48,101},{ 5,10}}, {{ 48,101},{ 5,10}},
+	{{ 48,105},{ 5,10}}, {{ 48,105},{ 5,10}}, {{ 48,105},{ 5,10}},
+	{{ 48,105},{ 5,10}}, {{ 48,111},{ 5,10}}, {{ 48,111},{ 5,10}},
+	{{ 48,111},{ 5,10}}, {{ 48,111},{ 5,10}}, {{ 48,115},{ 5,10}},
+	{{ 48,115},{ 5,10}}, {{ 48,115},{ 5,10}}, {{ 48,115},{ 5,10}},
+	{{ 48,116},{ 5,10}}, {{ 48,116},{ 5,10}}, {{ 48,116},{ 5,10}},
+	{{ 48,116},{ 5,10}}, {{ 48, 32},{ 5,11}}, {{ 48, 32},{ 5,11}},
+	{{ 48, 37},{ 5,11}}, {{ 48, 37},{ 5,11}}, {{ 48, 45},{ 5,11}},
+	{{ 48, 45},{ 5,11}}, {{ 48, 46},{ 5,11}}, {{ 48, 46},{ 5,11}},
+	{{ 48, 47},{ 5,11}}, {{ 48, 47},{ 5,11}}, {{ 48, 51},{ 5,11}},
+	{{ 48, 51},{ 5,11}}, {{ 48, 52},{ 5,11}}, {{ 48, 52},{ 5,11}},
+	{{ 48, 53},{ 5,11}}, {{ 48, 53},{ 5,11}}, {{ 48, 54},{ 5,11}},
+	{{ 48, 54},{ 5,11}}, {{ 48, 55},{ 5,11}}, {{ 48, 55},{ 5,11}},
+	{{ 48, 56},{ 5,11}}, {{ 48, 56},{ 5,11}}, {{ 48, 57},{ 5,11}},
+	{{ 48, 57},{ 5,11}}, {{ 48, 61},{ 5,11}}, {{ 48, 61},{ 5,11}},
+	{{ 48, 65},{ 5,11}}, {{ 48, 65},{ 5,11}}, {{ 48, 95},{ 5,11}},
+	{{ 48, 95},{ 5,11}}, {{ 48, 98},{ 5,11}}, {{ 48, 98},{ 5,11}},
+	{{ 48,100},{ 5,11}}, {{ 48,100},{ 5,11}}, {{ 48,102},{ 5,11}},
+	{{ 48,102},{ 5,11}}, {{ 48,103},{ 5,11}}, {{ 48,103},{ 5,11}},
+	{{ 48,104},{ 5,11}}, {{ 48,104},{ 5,11}}, {{ 48,108},{ 5,11}},
+	{{ 48,108},{ 5,11}}, {{ 48,109},{ 5,11}}, {{ 48,109},{ 5,11}},
+	{{ 48,110},{ 5,11}}, {{ 48,110},{ 5,11}}, {{ 48,112},{ 5,11}},
+	{{ 48,112},{ 5,11}}, {{ 48,114},{ 5,11}}, {{ 48,114},{ 5,11}},
+	{{ 48,117},{ 5,11}}, {{ 48,117},{ 5,11}}, {{ 48, 58},{ 5,12}},
+	{{ 48, 66},{ 5,12}}, {{ 48, 67},{ 5,12}}, {{ 48, 68},{ 5,12}},
+	{{ 48, 69},{ 5,12}}, {{ 48, 70},{ 5,12}}, {{ 48, 71},{ 5,12}},
+	{{ 48, 72},{ 5,12}}, {{ 48, 73},{ 5,12}}, {{ 48, 74},{ 5,12}},
+	{{ 48, 75},{ 5,12}}, {{ 48, 76},{ 5,12}}, {{ 48, 77},{ 5,12}},
+	{{ 48, 78},{ 5,12}}, {{ 48, 79},{ 5,12}}, {{ 48, 80},{ 5,12}},
+	{{ 48, 81},{ 5,12}}, {{ 48, 82},{ 5,12}}, {{ 48, 83},{ 5,12}},
+	{{ 48, 84},{ 5,12}}, {{ 48, 85},{ 5,12}}, {{ 48, 86},{ 5,12}},
+	{{ 48, 87},{ 5,12}}, {{ 48, 89},{ 5,12}}, {{ 48,106},{ 5,12}},
+	{{ 48,107},{ 5,12}}, {{ 48,113},{ 5,12}}, {{ 48,118},{ 5,12}},
+	{{ 48,119},{ 5,12}}, {{ 48,120},{ 5,12}}, {{ 48,121},{ 5,12}},
+	{{ 48,122},{ 5,12}}, {{ 48,  0},{ 5, 0}}, {{ 48,  0},{ 5, 0}},
+	{{ 48,  0},{ 5, 0}}, {{ 48,  0},{ 5, 0}}, {{ 49, 48},{ 5,10}},
+	{{ 49, 48},{ 5,10}}, {{ 49, 48},{ 5,10}}, {{ 49, 48},{ 5,10}},
+	{{ 49, 49},{ 5,10}}, {{ 49, 49},{ 5,10}}, {{ 49, 49},{ 5,10}},
+	{{ 49, 49},{ 5,10}}, {{ 49, 50},{ 5,10}}, {{ 49, 50},{ 5,10}},
+	{{ 49, 50},{ 5,10}}, {{ 49, 50},{ 5,10}}, {{ 49, 97},{ 5,10}},
+	{{ 49, 97},{ 5,10}}, {{ 49, 97},{ 5,10}}, {{ 49, 97},{ 5,10}},
+	{{ 49, 99},{ 5,10}}, {{ 49, 99},{ 5,10}}, {{ 49, 99},{ 5,10}},
+	{{ 49, 99},{ 5,10}}, {{ 49,101},{ 5,10}}, {{ 49,101},{ 5,10}},
+	{{ 49,101},{ 5,10}}, {{ 49,101},{ 5,10}}, {{ 49,105},{ 5,10}},
+	{{ 49,105},{ 5,10}}, {{ 49,105},{ 5,10}}, {{ 49,105},{ 5,10}},
+	{{ 49,111},{ 5,10}}, {{ 49,111},{ 5,10}}, {{ 49,111},{ 5,10}},
+	{{ 49,111},{ 5,10}}, {{ 49,115},{ 5,10}}, {{ 49,115},{ 5,10}},
+	{{ 49,115},{ 5,10}}, {{ 49,115},{ 5,10}}, {{ 49,116},{ 5,10}},
+	{{ 49,116},{ 5,10}}, {{ 49,116},{ 5,10}}, {{ 49,116},{ 5,10}},
+	{{ 49, 32},{ 5,11}}, {{ 49, 32},{ 5,11}}, {{ 49, 37},{ 5,11}},
+	{{ 49, 37},{ 5,11}}, {{ 49, 45},{ 5,11}}, {{ 49, 45},{ 5,11}},
+	{{ 49, 46},{ 5,11}}, {{ 49, 46},{ 5,11}}, {{ 49, 47},{ 5,11}},
+	{{ 49, 47},{ 5,11}}, {{ 49, 51},{ 5,11}}, {{ 49, 51},{ 5,11}},
+	{{ 49, 52},{ 5,11}}, {{ 49, 52},{ 5,11}}, {{ 49, 53},{ 5,11}},
+	{{ 49, 53},{ 5,11}}, {{ 49, 54},{ 5,11}}, {{ 49, 54},{ 5,11}},
+	{{ 49, 55},{ 5,11}}, {{ 49, 55},{ 5,11}}, {{ 49, 56},{ 5,11}},
+	{{ 49, 56},{ 5,11}}, {{ 49, 57},{ 5,11}}, {{ 49, 57},{ 5,11}},
+	{{ 49, 61},{ 5,11}}, {{ 49, 61},{ 5,11}}, {{ 49, 65},{ 5,11}},
+	{{ 49, 65},{ 5,11}}, {{ 49, 95},{ 5,11}}, {{ 49, 95},{ 5,11}},
+	{{ 49, 98},{ 5,11}}, {{ 49, 98},{ 5,11}}, {{ 49,100},{ 5,11}},
+	{{ 49,100},{ 5,11}}, {{ 49,102},{ 5,11}}, {{ 49,102},{ 5,11}},
+	{{ 49,103},{ 5,11}}, {{ 49,103},{ 5,11}}, {{ 49,104},{ 5,11}},
+	{{ 49,104},{ 5,11}}, {{ 49,108},{ 5,11}}, {{ 49,108},{ 5,11}},
+	{{ 49,109},{ 5,11}}, {{ 49,109},{ 5,11}}, {{ 49,110},{ 5,11}},
+	{{ 49,110},{ 5,11}}, {{ 49,112},{ 5,11}}, {{ 49,112},{ 5,11}},
+	{{ 49,114},{ 5,11}}, {{ 49,114},{ 5,11}}, {{ 49,117},{ 5,11}},
+	{{ 49,117},{ 5,11}}, {{ 49, 58},{ 5,12}}, {{ 49, 66},{ 5,12}},
+	{{ 49, 67},{ 5,12}}, {{ 49, 68},{ 5,12}}, {{ 49, 69},{ 5,12}},
+	{{ 49, 70},{ 5,12}}, {{ 49, 71},{ 5,12}}, {{ 49, 72},{ 5,12}},
+	{{ 49, 73},{ 5,12}}, {{ 49, 74},{ 5,12}}, {{ 49, 75},{ 5,12}},
+	{{ 49, 76},{ 5,12}}, {{ 49, 77},{ 5,12}}, {{ 49, 78},{ 5,12}},
+	{{ 49, 79},{ 5,12}}, {{ 49, 80},{ 5,12}}, {{ 49, 81},{ 5,12}},
+	{{ 49, 82},{ 5,12}}, {{ 49, 83},{ 5,12}}, {{ 49, 84},{ 5,12}},
+	{{ 49, 85},{ 5,12}}, {{ 49, 86},{ 5,12}}, {{ 49, 87},{ 5,12}},
+	{{ 49, 89},{ 5,12}}, {{ 49,106},{ 5,12}}, {{ 49,107},{ 5,12}},
+	{{ 49,113},{ 5,12}}, {{ 49,118},{ 5,12}}, {{ 49,119},{ 5,12}},
+	{{ 49,120},{ 5,12}}, {{ 49,121},{ 5,12}}, {{ 49,122},{ 5,12}},
+	{{ 49,  0},{ 5, 0}}, {{ 49,  0},{ 5, 0}}, {{ 49,  0},{ 5, 0}},
+	{{ 49,  0},{ 5, 0}}, {{ 50, 48},{ 5,10}}, {{ 50, 48},{ 5,10}},
+	{{ 50, 48},{ 5,10}}, {{ 50, 48},{ 5,10}}, {{ 50, 49},{ 5,10}},
+	{{ 50, 49},{ 5,10}}, {{ 50, 49},{ 5,10}}, {{ 50, 49},{ 5,10}},
+	{{ 50, 50},{ 5,10}}, {{ 50, 50},{ 5,10}}, {{ 50, 50},{ 5,10}},
+	{{ 50, 50},{ 5,10}}, {{ 50, 97},{ 5,10}}, {{ 50, 97},{ 5,10}},
+	{{ 50, 97},{ 5,10}}, {{ 50, 97},{ 5,10}}, {{ 50, 99},{ 5,10}},
+	{{ 50, 99},{ 5,10}}, {{ 50, 99},{ 5,10}}, {{ 50, 99},{ 5,10}},
+	{{ 50,101},{ 5,10}}, {{ 50,101},{ 5,10}}, {{ 50,101},{ 5,10}},
+	{{ 50,101},{ 5,10}}, {{ 50,105},{ 5,10}}, {{ 50,105},{ 5,10}},
+	{{ 50,105},{ 5,10}}, {{ 50,105},{ 5,10}}, {{ 50,111},{ 5,10}},
+	{{ 50,111},{ 5,10}}, {{ 50,111},{ 5,10}}, {{ 50,111},{ 5,10}},
+	{{ 50,115},{ 5,10}}, {{ 50,115},{ 5,10}}, {{ 50,115},{ 5,10}},
+	{{ 50,115},{ 5,10}}, {{ 50,116},{ 5,10}}, {{ 50,116},{ 5,10}},
+	{{ 50,116},{ 5,10}}, {{ 50,116},{ 5,10}}, {{ 50, 32},{ 5,11}},
+	{{ 50, 32},{ 5,11}}, {{ 50, 37},{ 5,11}}, {{ 50, 37},{ 5,11}},
+	{{ 50, 45},{ 5,11}}, {{ 50, 45},{ 5,11}}, {{ 50, 46},{ 5,11}},
+	{{ 50, 46},{ 5,11}}, {{ 50, 47},{ 5,11}}, {{ 50, 47},{ 5,11}},
+	{{ 50, 51},{ 5,11}}, {{ 50, 51},{ 5,11}}, {{ 50, 52},{ 5,11}},
+	{{ 50, 52},{ 5,11}}, {{ 50, 53},{ 5,11}}, {{ 50, 53},{ 5,11}},
+	{{ 50, 54},{ 5,11}}, {{ 50, 54},{ 5,11}}, {{ 50, 55},{ 5,11}},
+	{{ 50, 55},{ 5,11}}, {{ 50, 56},{ 5,11}}, {{ 50, 56},{ 5,11}},
+	{{ 50, 57},{ 5,11}}, {{ 50, 57},{ 5,11}}, {{ 50, 61},{ 5,11}},
+	{{ 50, 61},{ 5,11}}, {{ 50, 65},{ 5,11}}, {{ 50, 65},{ 5,11}},
+	{{ 50, 95},{ 5,11}}, {{ 50, 95},{ 5,11}}, {{ 50, 98},{ 5,11}},
+	{{ 50, 98},{ 5,11}}, {{ 50,100},{ 5,11}}, {{ 50,100},{ 5,11}},
+	{{ 50,102},{ 5,11}}, {{ 50,102},{ 5,11}}, {{ 50,103},{ 5,11}},
+	{{ 50,103},{ 5,11}}, {{ 50,104},{ 5,11}}, {{ 50,104},{ 5,11}},
+	{{ 50,108},{ 5,11}}, {{ 50,108},{ 5,11}}, {{ 50,109},{ 5,11}},
+	{{ 50,109},{ 5,11}}, {{ 50,110},{ 5,11}}, {{ 50,110},{ 5,11}},
+	{{ 50,112},{ 5,11}}, {{ 50,112},{ 5,11}}, {{ 50,114},{ 5,11}},
+	{{ 50,114},{ 5,11}}, {{ 50,117},{ 5,11}}, {{ 50,117},{ 5,11}},
+	{{ 50, 58},{ 5,12}}, {{ 50, 66},{ 5,12}}, {{ 50, 67},{ 5,12}},
+	{{ 50, 68},{ 5,12}}, {{ 50, 69},{ 5,12}}, {{ 50, 70},{ 5,12}},
+	{{ 50, 71},{ 5,12}}, {{ 50, 72},{ 5,12}}, {{ 50, 73},{ 5,12}},
+	{{ 50, 74},{ 5,12}}, {{ 50, 75},{ 5,12}}, {{ 50, 76},{ 5,12}},
+	{{ 50, 77},{ 5,12}}, {{ 50, 78},{ 5,12}}, {{ 50, 79},{ 5,12}},
+	{{ 50, 80},{ 5,12}}, {{ 50, 81},{ 5,12}}, {{ 50, 82},{ 5,12}},
+	{{ 50, 83},{ 5,12}}, {{ 50, 84},{ 5,12}}, {{ 50, 85},{ 5,12}},
+	{{ 50, 86},{ 5,12}}, {{ 50, 87},{ 5,12}}, {{ 50, 89},{ 5,12}},
+	{{ 50,106},{ 5,12}}, {{ 50,107},{ 5,12}}, {{ 50,113},{ 5,12}},
+	{{ 50,118},{ 5,12}}, {{ 50,119},{ 5,12}}, {{ 50,120},{ 5,12}},
+	{{ 50,121},{ 5,12}}, {{ 50,122},{ 5,12}}, {{ 50,  0},{ 5, 0}},
+	{{ 50,  0},{ 5, 0}}, {{ 50,  0},{ 5, 0}}, {{ 50,  0},{ 5, 0}},
+	{{ 97, 48},{ 5,10}}, {{ 97, 48},{ 5,10}}, {{ 97, 48},{ 5,10}},
+	{{ 97, 48},{ 5,10}}, {{ 97, 49},{ 5,10}}, {{ 97, 49},{ 5,10}},
+	{{ 97, 49},{ 5,10}}, {{ 97, 49},{ 5,10}}, {{ 97, 50},{ 5,10}},
+	{{ 97, 50},{ 5,10}}, {{ 97, 50},{ 5,10}}, {{ 97, 50},{ 5,10}},
+	{{ 97, 97},{ 5,10}}, {{ 97, 97},{ 5,10}}, {{ 97, 97},{ 5,10}},
+	{{ 97, 97},{ 5,10}}, {{ 97, 99},{ 5,10}}, {{ 97, 99},{ 5,10}},
+	{{ 97, 99},{ 5,10}}, {{ 97, 99},{ 5,10}}, {{ 97,101},{ 5,10}},
+	{{ 97,101},{ 5,10}}, {{ 97,101},{ 5,10}}, {{ 97,101},{ 5,10}},
+	{{ 97,105},{ 5,10}}, {{ 97,105},{ 5,10}}, {{ 97,105},{ 5,10}},
+	{{ 97,105},{ 5,10}}, {{ 97,111},{ 5,10}}, {{ 97,111},{ 5,10}},
+	{{ 97,111},{ 5,10}}, {{ 97,111},{ 5,10}}, {{ 97,115},{ 5,10}},
+	{{ 97,115},{ 5,10}}, {{ 97,115},{ 5,10}}, {{ 97,115},{ 5,10}},
+	{{ 97,116},{ 5,10}}, {{ 97,116},{ 5,10}}, {{ 97,116},{ 5,10}},
+	{{ 97,116},{ 5,10}}, {{ 97, 32},{ 5,11}}, {{ 97, 32},{ 5,11}},
+	{{ 97, 37},{ 5,11}}, {{ 97, 37},{ 5,11}}, {{ 97, 45},{ 5,11}},
+	{{ 97, 45},{ 5,11}}, {{ 97, 46},{ 5,11}}, {{ 97, 46},{ 5,11}},
+	{{ 97, 47},{ 5,11}}, {{ 97, 47},{ 5,11}}, {{ 97, 51},{ 5,11}},
+	{{ 97, 51},{ 5,11}}, {{ 97, 52},{ 5,11}}, {{ 97, 52},{ 5,11}},
+	{{ 97, 53},{ 5,11}}, {{ 97, 53},{ 5,11}}, {{ 97, 54},{ 5,11}},
+	{{ 97, 54},{ 5,11}}, {{ 97, 55},{ 5,11}}, {{ 97, 55},{ 5,11}},
+	{{ 97, 56},{ 5,11}}, {{ 97, 56},{ 5,11}}, {{ 97, 57},{ 5,11}},
+	{{ 97, 57},{ 5,11}}, {{ 97, 61},{ 5,11}}, {{ 97, 61},{ 5,11}},
+	{{ 97, 65},{ 5,11}}, {{ 97, 65},{ 5,11}}, {{ 97, 95},{ 5,11}},
+	{{ 97, 95},{ 5,11}}, {{ 97, 98},{ 5,11}}, {{ 97, 98},{ 5,11}},
+	{{ 97,100},{ 5,11}}, {{ 97,100},{ 5,11}}, {{ 97,102},{ 5,11}},
+	{{ 97,102},{ 5,11}}, {{ 97,103},{ 5,11}}, {{ 97,103},{ 5,11}},
+	{{ 97,104},{ 5,11}}, {{ 97,104},{ 5,11}}, {{ 97,108},{ 5,11}},
+	{{ 97,108},{ 5,11}}, {{ 97,109},{ 5,11}}, {{ 97,109},{ 5,11}},
+	{{ 97,110},{ 5,11}}, {{ 97,110},{ 5,11}}, {{ 97,112},{ 5,11}},
+	{{ 97,112},{ 5,11}}, {{ 97,114},{ 5,11}}, {{ 97,114},{ 5,11}},
+	{{ 97,117},{ 5,11}}, {{ 97,117},{ 5,11}}, {{ 97, 58},{ 5,12}},
+	{{ 97, 66},{ 5,12}}, {{ 97, 67},{ 5,12}}, {{ 97, 68},{ 5,12}},
+	{{ 97, 69},{ 5,12}}, {{ 97, 70},{ 5,12}}, {{ 97, 71},{ 5,12}},
+	{{ 97, 72},{ 5,12}}, {{ 97, 73},{ 5,12}}, {{ 97, 74},{ 5,12}},
+	{{ 97, 75},{ 5,12}}, {{ 97, 76},{ 5,12}}, {{ 97, 77},{ 5,12}},
+	{{ 97, 78},{ 5,12}}, {{ 97, 79},{ 5,12}}, {{ 97, 80},{ 5,12}},
+	{{ 97, 81},{ 5,12}}, {{ 97, 82},{ 5,12}}, {{ 97, 83},{ 5,12}},
+	{{ 97, 84},{ 5,12}}, {{ 97, 85},{ 5,12}}, {{ 97, 86},{ 5,12}},
+	{{ 97, 87},{ 5,12}}, {{ 97, 89},{ 5,12}}, {{ 97,106},{ 5,12}},
+	{{ 97,107},{ 5,12}}, {{ 97,113},{ 5,12}}, {{ 97,118},{ 5,12}},
+	{{ 97,119},{ 5,12}}, {{ 97,120},{ 5,12}}, {{ 97,121},{ 5,12}},
+	{{ 97,122},{ 5,12}}, {{ 97,  0},{ 5, 0}}, {{ 97,  0},{ 5, 0}},
+	{{ 97,  0},{ 5, 0}}, {{ 97,  0},{ 5, 0}}, {{ 99, 48},{ 5,10}},
+	{{ 99, 48},{ 5,10}}, {{ 99, 48},{ 5,10}}, {{ 99, 48},{ 5,10}},
+	{{ 99, 49},{ 5,10}}, {{ 99, 49},{ 5,10}}, {{ 99, 49},{ 5,10}},
+	{{ 99, 49},{ 5,10}}, {{ 99, 50},{ 5,10}}, {{ 99, 50},{ 5,10}},
+	{{ 99, 50},{ 5,10}}, {{ 99, 50},{ 5,10}}, {{ 99, 97},{ 5,10}},
+	{{ 99, 97},{ 5,10}}, {{ 99, 97},{ 5,10}}, {{ 99, 97},{ 5,10}},
+	{{ 99, 99},{ 5,10}}, {{ 99, 99},{ 5,10}}, {{ 99, 99},{ 5,10}},
+	{{ 99, 99},{ 5,10}}, {{ 99,101},{ 5,10}}, {{ 99,101},{ 5,10}},
+	{{ 99,101},{ 5,10}}, {{ 99,101},{ 5,10}}, {{ 99,105},{ 5,10}},
+	{{ 99,105},{ 5,10}}, {{ 99,105},{ 5,10}}, {{ 99,105},{ 5,10}},
+	{{ 99,111},{ 5,10}}, {{ 99,111},{ 5,10}}, {{ 99,111},{ 5,10}},
+	{{ 99,111},{ 5,10}}, {{ 99,115},{ 5,10}}, {{ 99,115},{ 5,10}},
+	{{ 99,115},{ 5,10}}, {{ 99,115},{ 5,10}}, {{ 99,116},{ 5,10}},
+	{{ 99,116},{ 5,10}}, {{ 99,116},{ 5,10}}, {{ 99,116},{ 5,10}},
+	{{ 99, 32},{ 5,11}}, {{ 99, 32},{ 5,11}}, {{ 99, 37},{ 5,11}},
+	{{ 99, 37},{ 5,11}}, {{ 99, 45},{ 5,11}}, {{ 99, 45},{ 5,11}},
+	{{ 99, 46},{ 5,11}}, {{ 99, 46},{ 5,11}}, {{ 99, 47},{ 5,11}},
+	{{ 99, 47},{ 5,11}}, {{ 99, 51},{ 5,11}}, {{ 99, 51},{ 5,11}},
+	{{ 99, 52},{ 5,11}}, {{ 99, 52},{ 5,11}}, {{ 99, 53},{ 5,11}},
+	{{ 99, 53},{ 5,11}}, {{ 99, 54},{ 5,11}}, {{ 99, 54},{ 5,11}},
+	{{ 99, 55},{ 5,11}}, {{ 99, 55},{ 5,11}}, {{ 99, 56},{ 5,11}},
+	{{ 99, 56},{ 5,11}}, {{ 99, 57},{ 5,11}}, {{ 99, 57},{ 5,11}},
+	{{ 99, 61},{ 5,11}}, {{ 99, 61},{ 5,11}}, {{ 99, 65},{ 5,11}},
+	{{ 99, 65},{ 5,11}}, {{ 99, 95},{ 5,11}}, {{ 99, 95},{ 5,11}},
+	{{ 99, 98},{ 5,11}}, {{ 99, 98},{ 5,11}}, {{ 99,100},{ 5,11}},
+	{{ 99,100},{ 5,11}}, {{ 99,102},{ 5,11}}, {{ 99,102},{ 5,11}},
+	{{ 99,103},{ 5,11}}, {{ 99,103},{ 5,11}}, {{ 99,104},{ 5,11}},
+	{{ 99,104},{ 5,11}}, {{ 99,108},{ 5,11}}, {{ 99,108},{ 5,11}},
+	{{ 99,109},{ 5,11}}, {{ 99,109},{ 5,11}}, {{ 99,110},{ 5,11}},
+	{{ 99,110},{ 5,11}}, {{ 99,112},{ 5,11}}, {{ 99,112},{ 5,11}},
+	{{ 99,114},{ 5,11}}, {{ 99,114},{ 5,11}}, {{ 99,117},{ 5,11}},
+	{{ 99,117},{ 5,11}}, {{ 99, 58},{ 5,12}}, {{ 99, 66},{ 5,12}},
+	{{ 99, 67},{ 5,12}}, {{ 99, 68},{ 5,12}}, {{ 99, 69},{ 5,12}},
+	{{ 99, 70},{ 5,12}}, {{ 99, 71},{ 5,12}}, {{ 99, 72},{ 5,12}},
+	{{ 99, 73},{ 5,12}}, {{ 99, 74},{ 5,12}}, {{ 99, 75},{ 5,12}},
+	{{ 99, 76},{ 5,12}}, {{ 99, 77},{ 5,12}}, {{ 99, 78},{ 5,12}},
+	{{ 99, 79},{ 5,12}}, {{ 99, 80},{ 5,12}}, {{ 99, 81},{ 5,12}},
+	{{ 99, 82},{ 5,12}}, {{ 99, 83},{ 5,12}}, {{ 99, 84},{ 5,12}},
+	{{ 99, 85},{ 5,12}}, {{ 99, 86},{ 5,12}}, {{ 99, 87},{ 5,12}},
+	{{ 99, 89},{ 5,12}}, {{ 99,106},{ 5,12}}, {{ 99,107},{ 5,12}},
+	{{ 99,113},{ 5,12}}, {{ 99,118},{ 5,12}}, {{ 99,119},{ 5,12}},
+	{{ 99,120},{ 5,12}}, {{ 99,121},{ 5,12}}, {{ 99,122},{ 5,12}},
+	{{ 99,  0},{ 5, 0}}, {{ 99,  0},{ 5, 0}}, {{ 99,  0},{ 5, 0}},
+	{{ 99,  0},{ 5, 0}}, {{101, 48},{ 5,10}}, {{101, 48},{ 5,10}},
+	{{101, 48},{ 5,10}}, {{101, 48},{ 5,10}}, {{101, 49},{ 5,10}},
+	{{101, 49},{ 5,10}}, {{101, 49},{ 5,10}}, {{101, 49},{ 5,10}},
+	{{101, 50},{ 5,10}}, {{101, 50},{ 5,10}}, {{101, 50},{ 5,10}},
+	{{101, 50},{ 5,10}}, {{101, 97},{ 5,10}}, {{101, 97},{ 5,10}},
+	{{101, 97},{ 5,10}}, {{101, 97},{ 5,10}}, {{101, 99},{ 5,10}},
+	{{101, 99},{ 5,10}}, {{101, 99},{ 5,10}}, {{101, 99},{ 5,10}},
+	{{101,101},{ 5,10}}, {{101,101},{ 5,10}}, {{101,101},{ 5,10}},
+	{{101,101},{ 5,10}}, {{101,105},{ 5,10}}, {{101,105},{ 5,10}},
+	{{101,105},{ 5,10}}, {{101,105},{ 5,10}}, {{101,111},{ 5,10}},
+	{{101,111},{ 5,10}}, {{101,111},{ 5,10}}, {{101,111},{ 5,10}},
+	{{101,115},{ 5,10}}, {{101,115},{ 5,10}}, {{101,115},{ 5,10}},
+	{{101,115},{ 5,10}}, {{101,116},{ 5,10}}, {{101,116},{ 5,10}},
+	{{101,116},{ 5,10}}, {{101,116},{ 5,10}}, {{101, 32},{ 5,11}},
+	{{101, 32},{ 5,11}}, {{101, 37},{ 5,11}}, {{101, 37},{ 5,11}},
+	{{101, 45},{ 5,11}}, {{101, 45},{ 5,11}}, {{101, 46},{ 5,11}},
+	{{101, 46},{ 5,11}}, {{101, 47},{ 5,11}}, {{101, 47},{ 5,11}},
+	{{101, 51},{ 5,11}}, {{101, 51},{ 5,11}}, {{101, 52},{ 5,11}},
+	{{101, 52},{ 5,11}}, {{101, 53},{ 5,11}}, {{101, 53},{ 5,11}},
+	{{101, 54},{ 5,11}}, {{101, 54},{ 5,11}}, {{101, 55},{ 5,11}},
+	{{101, 55},{ 5,11}}, {{101, 56},{ 5,11}}, {{101, 56},{ 5,11}},
+	{{101, 57},{ 5,11}}, {{101, 57},{ 5,11}}, {{101, 61},{ 5,11}},
+	{{101, 61},{ 5,11}}, {{101, 65},{ 5,11}}, {{101, 65},{ 5,11}},
+	{{101, 95},{ 5,11}}, {{101, 95},{ 5,11}}, {{101, 98},{ 5,11}},
+	{{101, 98},{ 5,11}}, {{101,100},{ 5,11}}, {{101,100},{ 5,11}},
+	{{101,102},{ 5,11}}, {{101,102},{ 5,11}}, {{101,103},{ 5,11}},
+	{{101,103},{ 5,11}}, {{101,104},{ 5,11}}, {{101,104},{ 5,11}},
+	{{101,108},{ 5,11}}, {{101,108},{ 5,11}}, {{101,109},{ 5,11}},
+	{{101,109},{ 5,11}}, {{101,110},{ 5,11}}, {{101,110},{ 5,11}},
+	{{101,112},{ 5,11}}, {{101,112},{ 5,11}}, {{101,114},{ 5,11}},
+	{{101,114},{ 5,11}}, {{101,117},{ 5,11}}, {{101,117},{ 5,11}},
+	{{101, 58},{ 5,12}}, {{101, 66},{ 5,12}}, {{101, 67},{ 5,12}},
+	{{101, 68},{ 5,12}}, {{101, 69},{ 5,12}}, {{101, 70},{ 5,12}},
+	{{101, 71},{ 5,12}}, {{101, 72},{ 5,12}}, {{101, 73},{ 5,12}},
+	{{101, 74},{ 5,12}}, {{101, 75},{ 5,12}}, {{101, 76},{ 5,12}},
+	{{101, 77},{ 5,12}}, {{101, 78},{ 5,12}}, {{101, 79},{ 5,12}},
+	{{101, 80},{ 5,12}}, {{101, 81},{ 5,12}}, {{101, 82},{ 5,12}},
+	{{101, 83},{ 5,12}}, {{101, 84},{ 5,12}}, {{101, 85},{ 5,12}},
+	{{101, 86},{ 5,12}}, {{101, 87},{ 5,12}}, {{101, 89},{ 5,12}},
+	{{101,106},{ 5,12}}, {{101,107},{ 5,12}}, {{101,113},{ 5,12}},
+	{{101,118},{ 5,12}}, {{101,119},{ 5,12}}, {{101,120},{ 5,12}},
+	{{101,121},{ 5,12}}, {{101,122},{ 5,12}}, {{101,  0},{ 5, 0}},
+	{{101,  0},{ 5, 0}}, {{101,  0},{ 5, 0}}, {{101,  0},{ 5, 0}},
+	{{105, 48},{ 5,10}}, {{105, 48},{ 5,10}}, {{105, 48},{ 5,10}},
+	{{105, 48},{ 5,10}}, {{105, 49},{ 5,10}}, {{105, 49},{ 5,10}},
+	{{105, 49},{ 5,10}}, {{105, 49},{ 5,10}}, {{105, 50},{ 5,10}},
+	{{105, 50},{ 5,10}}, {{105, 50},{ 5,10}}, {{105, 50},{ 5,10}},
+	{{105, 97},{ 5,10}}, {{105, 97},{ 5,10}}, {{105, 97},{ 5,10}},
+	{{105, 97},{ 5,10}}, {{105, 99},{ 5,10}}, {{105, 99},{ 5,10}},
+	{{105, 99},{ 5,10}}, {{105, 99},{ 5,10}}, {{105,101},{ 5,10}},
+	{{105,101},{ 5,10}}, {{105,101},{ 5,10}}, {{105,101},{ 5,10}},
+	{{105,105},{ 5,10}}, {{105,105},{ 5,10}}, {{105,105},{ 5,10}},
+	{{105,105},{ 5,10}}, {{105,111},{ 5,10}}, {{105,111},{ 5,10}},
+	{{105,111},{ 5,10}}, {{105,111},{ 5,10}}, {{105,115},{ 5,10}},
+	{{105,115},{ 5,10}}, {{105,115},{ 5,10}}, {{105,115},{ 5,10}},
+	{{105,116},{ 5,10}}, {{105,116},{ 5,10}}, {{105,116},{ 5,10}},
+	{{105,116},{ 5,10}}, {{105, 32},{ 5,11}}, {{105, 32},{ 5,11}},
+	{{105, 37},{ 5,11}}, {{105, 37},{ 5,11}}, {{105, 45},{ 5,11}},
+	{{105, 45},{ 5,11}}, {{105, 46},{ 5,11}}, {{105, 46},{ 5,11}},
+	{{105, 47},{ 5,11}}, {{105, 47},{ 5,11}}, {{105, 51},{ 5,11}},
+	{{105, 51},{ 5,11}}, {{105, 52},{ 5,11}}, {{105, 52},{ 5,11}},
+	{{105, 53},{ 5,11}}, {{105, 53},{ 5,11}}, {{105, 54},{ 5,11}},
+	{{105, 54},{ 5,11}}, {{105, 55},{ 5,11}}, {{105, 55},{ 5,11}},
+	{{105, 56},{ 5,11}}, {{105, 56},{ 5,11}}, {{105, 57},{ 5,11}},
+	{{105, 57},{ 5,11}}, {{105, 61},{ 5,11}}, {{105, 61},{ 5,11}},
+	{{105, 65},{ 5,11}}, {{105, 65},{ 5,11}}, {{105, 95},{ 5,11}},
+	{{105, 95},{ 5,11}}, {{105, 98},{ 5,11}}, {{105, 98},{ 5,11}},
+	{{105,100},{ 5,11}}, {{105,100},{ 5,11}}, {{105,102},{ 5,11}},
+	{{105,102},{ 5,11}}, {{105,103},{ 5,11}}, {{105,103},{ 5,11}},
+	{{105,104},{ 5,11}}, {{105,104},{ 5,11}}, {{105,108},{ 5,11}},
+	{{105,108},{ 5,11}}, {{105,109},{ 5,11}}, {{105,109},{ 5,11}},
+	{{105,110},{ 5,11}}, {{105,110},{ 5,11}}, {{105,112},{ 5,11}},
+	{{105,112},{ 5,11}}, {{105,114},{ 5,11}}, {{105,114},{ 5,11}},
+	{{105,117},{ 5,11}}, {{105,117},{ 5,11}}, {{105, 58},{ 5,12}},
+	{{105, 66},{ 5,12}}, {{105, 67},{ 5,12}}, {{105, 68},{ 5,12}},
+	{{105, 69},{ 5,12}}, {{105, 70},{ 5,12}}, {{105, 71},{ 5,12}},
+	{{105, 72},{ 5,12}}, {{105, 73},{ 5,12}}, {{105, 74},{ 5,12}},
+	{{105, 75},{ 5,12}}, {{105, 76},{ 5,12}}, {{105, 77},{ 5,12}},
+	{{105, 78},{ 5,12}}, {{105, 79},{ 5,12}}, {{105, 80},{ 5,12}},
+	{{105, 81},{ 5,12}}, {{105, 82},{ 5,12}}, {{105, 83},{ 5,12}},
+	{{105, 84},{ 5,12}}, {{105, 85},{ 5,12}}, {{105, 86},{ 5,12}},
+	{{105, 87},{ 5,12}}, {{105, 89},{ 5,12}}, {{105,106},{ 5,12}},
+	{{105,107},{ 5,12}}, {{105,113},{ 5,12}}, {{105,118},{ 5,12}},
+	{{105,119},{ 5,12}}, {{105,120},{ 5,12}}, {{105,121},{ 5,12}},
+	{{105,122},{ 5,12}}, {{105,  0},{ 5, 0}}, {{105,  0},{ 5, 0}},
+	{{105,  0},{ 5, 0}}, {{105,  0},{ 5, 0}}, {{111, 48},{ 5,10}},
+	{{111, 48},{ 5,10}}, {{111, 48},{ 5,10}}, {{111, 48},{ 5,10}},
+	{{111, 49},{ 5,10}}, {{111, 49},{ 5,10}}, {{111, 49},{ 5,10}},
+	{{111, 49},{ 5,10}}, {{111, 50},{ 5,10}}, {{111, 50},{ 5,10}},
+	{{111, 50},{ 5,10}}, {{111, 50},{ 5,10}}, {{111, 97},{ 5,10}},
+	{{111, 97},{ 5,10}}, {{111, 97},{ 5,10}}, {{111, 97},{ 5,10}},
+	{{111, 99},{ 5,10}}, {{111, 99},{ 5,10}}, {{111, 99},{ 5,10}},
+	{{111, 99},{ 5,10}}, {{111,101},{ 5,10}}, {{111,101},{ 5,10}},
+	{{111,101},{ 5,10}}, {{111,101},{ 5,10}}, {{111,105},{ 5,10}},
+	{{111,105},{ 5,10}}, {{111,105},{ 5,10}}, {{111,105},{ 5,10}},
+	{{111,111},{ 5,10}}, {{111,111},{ 5,10}}, {{111,111},{ 5,10}},
+	{{111,111},{ 5,10}}, {{111,115},{ 5,10}}, {{111,115},{ 5,10}},
+	{{111,115},{ 5,10}}, {{111,115},{ 5,10}}, {{111,116},{ 5,10}},
+	{{111,116},{ 5,10}}, {{111,116},{ 5,10}}, {{111,116},{ 5,10}},
+	{{111, 32},{ 5,11}}, {{111, 32},{ 5,11}}, {{111, 37},{ 5,11}},
+	{{111, 37},{ 5,11}}, {{111, 45},{ 5,11}}, {{111, 45},{ 5,11}},
+	{{111, 46},{ 5,11}}, {{111, 46},{ 5,11}}, {{111, 47},{ 5,11}},
+	{{111, 47},{ 5,11}}, {{111, 51},{ 5,11}}, {{111, 51},{ 5,11}},
+	{{111, 52},{ 5,11}}, {{111, 52},{ 5,11}}, {{111, 53},{ 5,11}},
+	{{111, 53},{ 5,11}}, {{111, 54},{ 5,11}}, {{111, 54},{ 5,11}},
+	{{111, 55},{ 5,11}}, {{111, 55},{ 5,11}}, {{111, 56},{ 5,11}},
+	{{111, 56},{ 5,11}}, {{111, 57},{ 5,11}}, {{111, 57},{ 5,11}},
+	{{111, 61},{ 5,11}}, {{111, 61},{ 5,11}}, {{111, 65},{ 5,11}},
+	{{111, 65},{ 5,11}}, {{111, 95},{ 5,11}}, {{111, 95},{ 5,11}},
+	{{111, 98},{ 5,11}}, {{111, 98},{ 5,11}}, {{111,100},{ 5,11}},
+	{{111,100},{ 5,11}}, {{111,102},{ 5,11}}, {{111,102},{ 5,11}},
+	{{111,103},{ 5,11}}, {{111,103},{ 5,11}}, {{111,104},{ 5,11}},
+	{{111,104},{ 5,11}}, {{111,108},{ 5,11}}, {{111,108},{ 5,11}},
+	{{111,109},{ 5,11}}, {{111,109},{ 5,11}}, {{111,110},{ 5,11}},
+	{{111,110},{ 5,11}}, {{111,112},{ 5,11}}, {{111,112},{ 5,11}},
+	{{111,114},{ 5,11}}, {{111,114},{ 5,11}}, {{111,117},{ 5,11}},
+	{{111,117},{ 5,11}}, {{111, 58},{ 5,12}}, {{111, 66},{ 5,12}},
+	{{111, 67},{ 5,12}}, {{111, 68},{ 5,12}}, {{111, 69},{ 5,12}},
+	{{111, 70},{ 5,12}}, {{111, 71},{ 5,12}}, {{111, 72},{ 5,12}},
+	{{111, 73},{ 5,12}}, {{111, 74},{ 5,12}}, {{111, 75},{ 5,12}},
+	{{111, 76},{ 5,12}}, {{111, 77},{ 5,12}}, {{111, 78},{ 5,12}},
+	{{111, 79},{ 5,12}}, {{111, 80},{ 5,12}}, {{111, 81},{ 5,12}},
+	{{111, 82},{ 5,12}}, {{111, 83},{ 5,12}}, {{111, 84},{ 5,12}},
+	{{111, 85},{ 5,12}}, {{111, 86},{ 5,12}}, {{111, 87},{ 5,12}},
+	{{111, 89},{ 5,12}}, {{111,106},{ 5,12}}, {{111,107},{ 5,12}},
+	{{111,113},{ 5,12}}, {{111,118},{ 5,12}}, {{111,119},{ 5,12}},
+	{{111,120},{ 5,12}}, {{111,121},{ 5,12}}, {{111,122},{ 5,12}},
+	{{111,  0},{ 5, 0}}, {{111,  0},{ 5, 0}}, {{111,  0},{ 5, 0}},
+	{{111,  0},{ 5, 0}}, {{115, 48},{ 5,10}}, {{115, 48},{ 5,10}},
+	{{115, 48},{ 5,10}}, {{115, 48},{ 5,10}}, {{115, 49},{ 5,10}},
+	{{115, 49},{ 5,10}}, {{115, 49},{ 5,10}}, {{115, 49},{ 5,10}},
+	{{115, 50},{ 5,10}}, {{115, 50},{ 5,10}}, {{115, 50},{ 5,10}},
+	{{115, 50},{ 5,10}}, {{115, 97},{ 5,10}}, {{115, 97},{ 5,10}},
+	{{115, 97},{ 5,10}}, {{115, 97},{ 5,10}}, {{115, 99},{ 5,10}},
+	{{115, 99},{ 5,10}}, {{115, 99},{ 5,10}}, {{115, 99},{ 5,10}},
+	{{115,101},{ 5,10}}, {{115,101},{ 5,10}}, {{115,101},{ 5,10}},
+	{{115,101},{ 5,10}}, {{115,105},{ 5,10}}, {{115,105},{ 5,10}},
+	{{115,105},{ 5,10}}, {{115,105},{ 5,10}}, {{115,111},{ 5,10}},
+	{{115,111},{ 5,10}}, {{115,111},{ 5,10}}, {{115,111},{ 5,10}},
+	{{115,115},{ 5,10}}, {{115,115},{ 5,10}}, {{115,115},{ 5,10}},
+	{{115,115},{ 5,10}}, {{115,116},{ 5,10}}, {{115,116},{ 5,10}},
+	{{115,116},{ 5,10}}, {{115,116},{ 5,10}}, {{115, 32},{ 5,11}},
+	{{115, 32},{ 5,11}}, {{115, 37},{ 5,11}}, {{115, 37},{ 5,11}},
+	{{115, 45},{ 5,11}}, {{115, 45},{ 5,11}}, {{115, 46},{ 5,11}},
+	{{115, 46},{ 5,11}}, {{115, 47},{ 5,11}}, {{115, 47},{ 5,11}},
+	{{115, 51},{ 5,11}}, {{115, 51},{ 5,11}}, {{115, 52},{ 5,11}},
+	{{115, 52},{ 5,11}}, {{115, 53},{ 5,11}}, {{115, 53},{ 5,11}},
+	{{115, 54},{ 5,11}}, {{115, 54},{ 5,11}}, {{115, 55},{ 5,11}},
+	{{115, 55},{ 5,11}}, {{115, 56},{ 5,11}}, {{115, 56},{ 5,11}},
+	{{115, 57},{ 5,11}}, {{115, 57},{ 5,11}}, {{115, 61},{ 5,11}},
+	{{115, 61},{ 5,11}}, {{115, 65},{ 5,11}}, {{115, 65},{ 5,11}},
+	{{115, 95},{ 5,11}}, {{115, 95},{ 5,11}}, {{115, 98},{ 5,11}},
+	{{115, 98},{ 5,11}}, {{115,100},{ 5,11}}, {{115,100},{ 5,11}},
+	{{115,102},{ 5,11}}, {{115,102},{ 5,11}}, {{115,103},{ 5,11}},
+	{{115,103},{ 5,11}}, {{115,104},{ 5,11}}, {{115,104},{ 5,11}},
+	{{115,108},{ 5,11}}, {{115,108},{ 5,11}}, {{115,109},{ 5,11}},
+	{{115,109},{ 5,11}}, {{115,110},{ 5,11}}, {{115,110},{ 5,11}},
+	{{115,112},{ 5,11}}, {{115,112},{ 5,11}}, {{115,114},{ 5,11}},
+	{{115,114},{ 5,11}}, {{115,117},{ 5,11}}, {{115,117},{ 5,11}},
+	{{115, 58},{ 5,12}}, {{115, 66},{ 5,12}}, {{115, 67},{ 5,12}},
+	{{115, 68},{ 5,12}}, {{115, 69},{ 5,12}}, {{115, 70},{ 5,12}},
+	{{115, 71},{ 5,12}}, {{115, 72},{ 5,12}}, {{115, 73},{ 5,12}},
+	{{115, 74},{ 5,12}}, {{115, 75},{ 5,12}}, {{115, 76},{ 5,12}},
+	{{115, 77},{ 5,12}}, {{115, 78},{ 5,12}}, {{115, 79},{ 5,12}},
+	{{115, 80},{ 5,12}}, {{115, 81},{ 5,12}}, {{115, 82},{ 5,12}},
+	{{115, 83},{ 5,12}}, {{115, 84},{ 5,12}}, {{115, 85},{ 5,12}},
+	{{115, 86},{ 5,12}}, {{115, 87},{ 5,12}}, {{115, 89},{ 5,12}},
+	{{115,106},{ 5,12}}, {{115,107},{ 5,12}}, {{115,113},{ 5,12}},
+	{{115,118},{ 5,12}}, {{115,119},{ 5,12}}, {{115,120},{ 5,12}},
+	{{115,121},{ 5,12}}, {{115,122},{ 5,12}}, {{115,  0},{ 5, 0}},
+	{{115,  0},{ 5, 0}}, {{115,  0},{ 5, 0}}, {{115,  0},{ 5, 0}},
+	{{116, 48},{ 5,10}}, {{116, 48},{ 5,10}}, {{116, 48},{ 5,10}},
+	{{116, 48},{ 5,10}}, {{116, 49},{ 5,10}}, {{116, 49},{ 5,10}},
+	{{116, 49},{ 5,10}}, {{116, 49},{ 5,10}}, {{116, 50},{ 5,10}},
+	{{116, 50},{ 5,10}}, {{116, 50},{ 5,10}}, {{116, 50},{ 5,10}},
+	{{116, 97},{ 5,10}}, {{116, 97},{ 5,10}}, {{116, 97},{ 5,10}},
+	{{116, 97},{ 5,10}}, {{116, 99},{ 5,10}}, {{116, 99},{ 5,10}},
+	{{116, 99},{ 5,10}}, {{116, 99},{ 5,10}}, {{116,101},{ 5,10}},
+	{{116,101},{ 5,10}}, {{116,101},{ 5,10}}, {{116,101},{ 5,10}},
+	{{116,105},{ 5,10}}, {{116,105},{ 5,10}}, {{116,105},{ 5,10}},
+	{{116,105},{ 5,10}}, {{116,111},{ 5,10}}, {{116,111},{ 5,10}},
+	{{116,111},{ 5,10}}, {{116,111},{ 5,10}}, {{116,115},{ 5,10}},
+	{{116,115},{ 5,10}}, {{116,115},{ 5,10}}, {{116,115},{ 5,10}},
+	{{116,116},{ 5,10}}, {{116,116},{ 5,10}}, {{116,116},{ 5,10}},
+	{{116,116},{ 5,10}}, {{116, 32},{ 5,11}}, {{116, 32},{ 5,11}},
+	{{116, 37},{ 5,11}}, {{116, 37},{ 5,11}}, {{116, 45},{ 5,11}},
+	{{116, 45},{ 5,11}}, {{116, 46},{ 5,11}}, {{116, 46},{ 5,11}},
+	{{116, 47},{ 5,11}}, {{116, 47},{ 5,11}}, {{116, 51},{ 5,11}},
+	{{116, 51},{ 5,11}}, {{116, 52},{ 5,11}}, {{116, 52},{ 5,11}},
+	{{116, 53},{ 5,11}}, {{116, 53},{ 5,11}}, {{116, 54},{ 5,11}},
+	{{116, 54},{ 5,11}}, {{116, 55},{ 5,11}}, {{116, 55},{ 5,11}},
+	{{116, 56},{ 5,11}}, {{116, 56},{ 5,11}}, {{116, 57},{ 5,11}},
+	{{116, 57},{ 5,11}}, {{116, 61},{ 5,11}}, {{116, 61},{ 5,11}},
+	{{116, 65},{ 5,11}}, {{116, 65},{ 5,11}}, {{116, 95},{ 5,11}},
+	{{116, 95},{ 5,11}}, {{116, 98},{ 5,11}}, {{116, 98},{ 5,11}},
+	{{116,100},{ 5,11}}, {{116,100},{ 5,11}}, {{116,102},{ 5,11}},
+	{{116,102},{ 5,11}}, {{116,103},{ 5,11}}, {{116,103},{ 5,11}},
+	{{116,104},{ 5,11}}, {{116,104},{ 5,11}}, {{116,108},{ 5,11}},
+	{{116,108},{ 5,11}}, {{116,109},{ 5,11}}, {{116,109},{ 5,11}},
+	{{116,110},{ 5,11}}, {{116,110},{ 5,11}}, {{116,112},{ 5,11}},
+	{{116,112},{ 5,11}}, {{116,114},{ 5,11}}, {{116,114},{ 5,11}},
+	{{116,117},{ 5,11}}, {{116,117},{ 5,11}}, {{116, 58},{ 5,12}},
+	{{116, 66},{ 5,12}}, {{116, 67},{ 5,12}}, {{116, 68},{ 5,12}},
+	{{116, 69},{ 5,12}}, {{116, 70},{ 5,12}}, {{116, 71},{ 5,12}},
+	{{116, 72},{ 5,12}}, {{116, 73},{ 5,12}}, {{116, 74},{ 5,12}},
+	{{116, 75},{ 5,12}}, {{116, 76},{ 5,12}}, {{116, 77},{ 5,12}},
+	{{116, 78},{ 5,12}}, {{116, 79},{ 5,12}}, {{116, 80},{ 5,12}},
+	{{116, 81},{ 5,12}}, {{116, 82},{ 5,12}}, {{116, 83},{ 5,12}},
+	{{116, 84},{ 5,12}}, {{116, 85},{ 5,12}}, {{116, 86},{ 5,12}},
+	{{116, 87},{ 5,12}}, {{116, 89},{ 5,12}}, {{116,106},{ 5,12}},
+	{{116,107},{ 5,12}}, {{116,113},{ 5,12}}, {{116,118},{ 5,12}},
+	{{116,119},{ 5,12}}, {{116,120},{ 5,12}}, {{116,121},{ 5,12}},
+	{{116,122},{ 5,12}}, {{116,  0},{ 5, 0}}, {{116,  0},{ 5, 0}},
+	{{116,  0},{ 5, 0}}, {{116,  0},{ 5, 0}}, {{ 32, 48},{ 6,11}},
+	{{ 32, 48},{ 6,11}}, {{ 32, 49},{ 6,11}}, {{ 32, 49},{ 6,11}},
+	{{ 32, 50},{ 6,11}}, {{ 32, 50},{ 6,11}}, {{ 32, 97},{ 6,11}},
+	{{ 32, 97},{ 6,11}}, {{ 32, 99},{ 6,11}}, {{ 32, 99},{ 6,11}},
+	{{ 32,101},{ 6,11}}, {{ 32,101},{ 6,11}}, {{ 32,105},{ 6,11}},
+	{{ 32,105},{ 6,11}}, {{ 32,111},{ 6,11}}, {{ 32,111},{ 6,11}},
+	{{ 32,115},{ 6,11}}, {{ 32,115},{ 6,11}}, {{ 32,116},{ 6,11}},
+	{{ 32,116},{ 6,11}}, {{ 32, 32},{ 6,12}}, {{ 32, 37},{ 6,12}},
+	{{ 32, 45},{ 6,12}}, {{ 32, 46},{ 6,12}}, {{ 32, 47},{ 6,12}},
+	{{ 32, 51},{ 6,12}}, {{ 32, 52},{ 6,12}}, {{ 32, 53},{ 6,12}},
+	{{ 32, 54},{ 6,12}}, {{ 32, 55},{ 6,12}}, {{ 32, 56},{ 6,12}},
+	{{ 32, 57},{ 6,12}}, {{ 32, 61},{ 6,12}}, {{ 32, 65},{ 6,12}},
+	{{ 32, 95},{ 6,12}}, {{ 32, 98},{ 6,12}}, {{ 32,100},{ 6,12}},
+	{{ 32,102},{ 6,12}}, {{ 32,103},{ 6,12}}, {{ 32,104},{ 6,12}},
+	{{ 32,108},{ 6,12}}, {{ 32,109},{ 6,12}}, {{ 32,110},{ 6,12}},
+	{{ 32,112},{ 6,12}}, {{ 32,114},{ 6,12}}, {{ 32,117},{ 6,12}},
+	{{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}},
+	{{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}},
+	{{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}},
+	{{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}},
+	{{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}},
+	{{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}}, {{ 32,  0},{ 6, 0}},
+	{{ 37, 48},{ 6,11}}, {{ 37, 48},{ 6,11}}, {{ 37, 49},{ 6,11}},
+	{{ 37, 49},{ 6,11}}, {{ 37, 50},{ 6,11}}, {{ 37, 50},{ 6,11}},
+	{{ 37, 97},{ 6,11}}, {{ 37, 97},{ 6,11}}, {{ 37, 99},{ 6,11}},
+	{{ 37, 99},{ 6,11}}, {{ 37,101},{ 6,11}}, {{ 37,101},{ 6,11}},
+	{{ 37,105},{ 6,11}}, {{ 37,105},{ 6,11}}, {{ 37,111},{ 6,11}},
+	{{ 37,111},{ 6,11}}, {{ 37,115},{ 6,11}}, {{ 37,115},{ 6,11}},
+	{{ 37,116},{ 6,11}}, {{ 37,116},{ 6,11}}, {{ 37, 32},{ 6,12}},
+	{{ 37, 37},{ 6,12}}, {{ 37, 45},{ 6,12}}, {{ 37, 46},{ 6,12}},
+	{{ 37, 47},{ 6,12}}, {{ 37, 51},{ 6,12}}, {{ 37, 52},{ 6,12}},
+	{{ 37, 53},{ 6,12}}, {{ 37, 54},{ 6,12}}, {{ 37, 55},{ 6,12}},
+	{{ 37, 56},{ 6,12}}, {{ 37, 57},{ 6,12}}, {{ 37, 61},{ 6,12}},
+	{{ 37, 65},{ 6,12}}, {{ 37, 95},{ 6,12}}, {{ 37, 98},{ 6,12}},
+	{{ 37,100},{ 6,12}}, {{ 37,102},{ 6,12}}, {{ 37,103},{ 6,12}},
+	{{ 37,104},{ 6,12}}, {{ 37,108},{ 6,12}}, {{ 37,109},{ 6,12}},
+	{{ 37,110},{ 6,12}}, {{ 37,112},{ 6,12}}, {{ 37,114},{ 6,12}},
+	{{ 37,117},{ 6,12}}, {{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}},
+	{{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}},
+	{{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}},
+	{{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}},
+	{{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}},
+	{{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}}, {{ 37,  0},{ 6, 0}},
+	{{ 37,  0},{ 6, 0}}, {{ 45, 48},{ 6,11}}, {{ 45, 48},{ 6,11}},
+	{{ 45, 49},{ 6,11}}, {{ 45, 49},{ 6,11}}, {{ 45, 50},{ 6,11}},
+	{{ 45, 50},{ 6,11}}, {{ 45, 97},{ 6,11}}, {{ 45, 97},{ 6,11}},
+	{{ 45, 99},{ 6,11}}, {{ 45, 99},{ 6,11}}, {{ 45,101},{ 6,11}},
+	{{ 45,101},{ 6,11}}, {{ 45,105},{ 6,11}}, {{ 45,105},{ 6,11}},
+	{{ 45,111},{ 6,11}}, {{ 45,111},{ 6,11}}, {{ 45,115},{ 6,11}},
+	{{ 45,115},{ 6,11}}, {{ 45,116},{ 6,11}}, {{ 45,116},{ 6,11}},
+	{{ 45, 32},{ 6,12}}, {{ 45, 37},{ 6,12}}, {{ 45, 45},{ 6,12}},
+	{{ 45, 46},{ 6,12}}, {{ 45, 47},{ 6,12}}, {{ 45, 51},{ 6,12}},
+	{{ 45, 52},{ 6,12}}, {{ 45, 53},{ 6,12}}, {{ 45, 54},{ 6,12}},
+	{{ 45, 55},{ 6,12}}, {{ 45, 56},{ 6,12}}, {{ 45, 57},{ 6,12}},
+	{{ 45, 61},{ 6,12}}, {{ 45, 65},{ 6,12}}, {{ 45, 95},{ 6,12}},
+	{{ 45, 98},{ 6,12}}, {{ 45,100},{ 6,12}}, {{ 45,102},{ 6,12}},
+	{{ 45,103},{ 6,12}}, {{ 45,104},{ 6,12}}, {{ 45,108},{ 6,12}},
+	{{ 45,109},{ 6,12}}, {{ 45,110},{ 6,12}}, {{ 45,112},{ 6,12}},
+	{{ 45,114},{ 6,12}}, {{ 45,117},{ 6,12}}, {{ 45,  0},{ 6, 0}},
+	{{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}},
+	{{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}},
+	{{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}},
+	{{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}},
+	{{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}},
+	{{ 45,  0},{ 6, 0}}, {{ 45,  0},{ 6, 0}}, {{ 46, 48},{ 6,11}},
+	{{ 46, 48},{ 6,11}}, {{ 46, 49},{ 6,11}}, {{ 46, 49},{ 6,11}},
+	{{ 46, 50},{ 6,11}}, {{ 46, 50},{ 6,11}}, {{ 46, 97},{ 6,11}},
+	{{ 46, 97},{ 6,11}}, {{ 46, 99},{ 6,11}}, {{ 46, 99},{ 6,11}},
+	{{ 46,101},{ 6,11}}, {{ 46,101},{ 6,11}}, {{ 46,105},{ 6,11}},
+	{{ 46,105},{ 6,11}}, {{ 46,111},{ 6,11}}, {{ 46,111},{ 6,11}},
+	{{ 46,115},{ 6,11}}, {{ 46,115},{ 6,11}}, {{ 46,116},{ 6,11}},
+	{{ 46,116},{ 6,11}}, {{ 46, 32},{ 6,12}}, {{ 46, 37},{ 6,12}},
+	{{ 46, 45},{ 6,12}}, {{ 46, 46},{ 6,12}}, {{ 46, 47},{ 6,12}},
+	{{ 46, 51},{ 6,12}}, {{ 46, 52},{ 6,12}}, {{ 46, 53},{ 6,12}},
+	{{ 46, 54},{ 6,12}}, {{ 46, 55},{ 6,12}}, {{ 46, 56},{ 6,12}},
+	{{ 46, 57},{ 6,12}}, {{ 46, 61},{ 6,12}}, {{ 46, 65},{ 6,12}},
+	{{ 46, 95},{ 6,12}}, {{ 46, 98},{ 6,12}}, {{ 46,100},{ 6,12}},
+	{{ 46,102},{ 6,12}}, {{ 46,103},{ 6,12}}, {{ 46,104},{ 6,12}},
+	{{ 46,108},{ 6,12}}, {{ 46,109},{ 6,12}}, {{ 46,110},{ 6,12}},
+	{{ 46,112},{ 6,12}}, {{ 46,114},{ 6,12}}, {{ 46,117},{ 6,12}},
+	{{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}},
+	{{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}},
+	{{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}},
+	{{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}},
+	{{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}},
+	{{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}}, {{ 46,  0},{ 6, 0}},
+	{{ 47, 48},{ 6,11}}, {{ 47, 48},{ 6,11}}, {{ 47, 49},{ 6,11}},
+	{{ 47, 49},{ 6,11}}, {{ 47, 50},{ 6,11}}, {{ 47, 50},{ 6,11}},
+	{{ 47, 97},{ 6,11}}, {{ 47, 97},{ 6,11}}, {{ 47, 99},{ 6,11}},
+	{{ 47, 99},{ 6,11}}, {{ 47,101},{ 6,11}}, {{ 47,101},{ 6,11}},
+	{{ 47,105},{ 6,11}}, {{ 47,105},{ 6,11}}, {{ 47,111},{ 6,11}},
+	{{ 47,111},{ 6,11}}, {{ 47,115},{ 6,11}}, {{ 47,115},{ 6,11}},
+	{{ 47,116},{ 6,11}}, {{ 47,116},{ 6,11}}, {{ 47, 32},{ 6,12}},
+	{{ 47, 37},{ 6,12}}, {{ 47, 45},{ 6,12}}, {{ 47, 46},{ 6,12}},
+	{{ 47, 47},{ 6,12}}, {{ 47, 51},{ 6,12}}, {{ 47, 52},{ 6,12}},
+	{{ 47, 53},{ 6,12}}, {{ 47, 54},{ 6,12}}, {{ 47, 55},{ 6,12}},
+	{{ 47, 56},{ 6,12}}, {{ 47, 57},{ 6,12}}, {{ 47, 61},{ 6,12}},
+	{{ 47, 65},{ 6,12}}, {{ 47, 95},{ 6,12}}, {{ 47, 98},{ 6,12}},
+	{{ 47,100},{ 6,12}}, {{ 47,102},{ 6,12}}, {{ 47,103},{ 6,12}},
+	{{ 47,104},{ 6,12}}, {{ 47,108},{ 6,12}}, {{ 47,109},{ 6,12}},
+	{{ 47,110},{ 6,12}}, {{ 47,112},{ 6,12}}, {{ 47,114},{ 6,12}},
+	{{ 47,117},{ 6,12}}, {{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}},
+	{{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}},
+	{{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}},
+	{{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}},
+	{{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}},
+	{{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}}, {{ 47,  0},{ 6, 0}},
+	{{ 47,  0},{ 6, 0}}, {{ 51, 48},{ 6,11}}, {{ 51, 48},{ 6,11}},
+	{{ 51, 49},{ 6,11}}, {{ 51, 49},{ 6,11}}, {{ 51, 50},{ 6,11}},
+	{{ 51, 50},{ 6,11}}, {{ 51, 97},{ 6,11}}, {{ 51, 97},{ 6,11}},
+	{{ 51, 99},{ 6,11}}, {{ 51, 99},{ 6,11}}, {{ 51,101},{ 6,11}},
+	{{ 51,101},{ 6,11}}, {{ 51,105},{ 6,11}}, {{ 51,105},{ 6,11}},
+	{{ 51,111},{ 6,11}}, {{ 51,111},{ 6,11}}, {{ 51,115},{ 6,11}},
+	{{ 51,115},{ 6,11}}, {{ 51,116},{ 6,11}}, {{ 51,116},{ 6,11}},
+	{{ 51, 32},{ 6,12}}, {{ 51, 37},{ 6,12}}, {{ 51, 45},{ 6,12}},
+	{{ 51, 46},{ 6,12}}, {{ 51, 47},{ 6,12}}, {{ 51, 51},{ 6,12}},
+	{{ 51, 52},{ 6,12}}, {{ 51, 53},{ 6,12}}, {{ 51, 54},{ 6,12}},
+	{{ 51, 55},{ 6,12}}, {{ 51, 56},{ 6,12}}, {{ 51, 57},{ 6,12}},
+	{{ 51, 61},{ 6,12}}, {{ 51, 65},{ 6,12}}, {{ 51, 95},{ 6,12}},
+	{{ 51, 98},{ 6,12}}, {{ 51,100},{ 6,12}}, {{ 51,102},{ 6,12}},
+	{{ 51,103},{ 6,12}}, {{ 51,104},{ 6,12}}, {{ 51,108},{ 6,12}},
+	{{ 51,109},{ 6,12}}, {{ 51,110},{ 6,12}}, {{ 51,112},{ 6,12}},
+	{{ 51,114},{ 6,12}}, {{ 51,117},{ 6,12}}, {{ 51,  0},{ 6, 0}},
+	{{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}},
+	{{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}},
+	{{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}},
+	{{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}},
+	{{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}},
+	{{ 51,  0},{ 6, 0}}, {{ 51,  0},{ 6, 0}}, {{ 52, 48},{ 6,11}},
+	{{ 52, 48},{ 6,11}}, {{ 52, 49},{ 6,11}}, {{ 52, 49},{ 6,11}},
+	{{ 52, 50},{ 6,11}}, {{ 52, 50},{ 6,11}}, {{ 52, 97},{ 6,11}},
+	{{ 52, 97},{ 6,11}}, {{ 52, 99},{ 6,11}}, {{ 52, 99},{ 6,11}},
+	{{ 52,101},{ 6,11}}, {{ 52,101},{ 6,11}}, {{ 52,105},{ 6,11}},
+	{{ 52,105},{ 6,11}}, {{ 52,111},{ 6,11}}, {{ 52,111},{ 6,11}},
+	{{ 52,115},{ 6,11}}, {{ 52,115},{ 6,11}}, {{ 52,116},{ 6,11}},
+	{{ 52,116},{ 6,11}}, {{ 52, 32},{ 6,12}}, {{ 52, 37},{ 6,12}},
+	{{ 52, 45},{ 6,12}}, {{ 52, 46},{ 6,12}}, {{ 52, 47},{ 6,12}},
+	{{ 52, 51},{ 6,12}}, {{ 52, 52},{ 6,12}}, {{ 52, 53},{ 6,12}},
+	{{ 52, 54},{ 6,12}}, {{ 52, 55},{ 6,12}}, {{ 52, 56},{ 6,12}},
+	{{ 52, 57},{ 6,12}}, {{ 52, 61},{ 6,12}}, {{ 52, 65},{ 6,12}},
+	{{ 52, 95},{ 6,12}}, {{ 52, 98},{ 6,12}}, {{ 52,100},{ 6,12}},
+	{{ 52,102},{ 6,12}}, {{ 52,103},{ 6,12}}, {{ 52,104},{ 6,12}},
+	{{ 52,108},{ 6,12}}, {{ 52,109},{ 6,12}}, {{ 52,110},{ 6,12}},
+	{{ 52,112},{ 6,12}}, {{ 52,114},{ 6,12}}, {{ 52,117},{ 6,12}},
+	{{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}},
+	{{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}},
+	{{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}},
+	{{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}},
+	{{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}},
+	{{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}}, {{ 52,  0},{ 6, 0}},
+	{{ 53, 48},{ 6,11}}, {{ 53, 48},{ 6,11}}, {{ 53, 49},{ 6,11}},
+	{{ 53, 49},{ 6,11}}, {{ 53, 50},{ 6,11}}, {{ 53, 50},{ 6,11}},
+	{{ 53, 97},{ 6,11}}, {{ 53, 97},{ 6,11}}, {{ 53, 99},{ 6,11}},
+	{{ 53, 99},{ 6,11}}, {{ 53,101},{ 6,11}}, {{ 53,101},{ 6,11}},
+	{{ 53,105},{ 6,11}}, {{ 53,105},{ 6,11}}, {{ 53,111},{ 6,11}},
+	{{ 53,111},{ 6,11}}, {{ 53,115},{ 6,11}}, {{ 53,115},{ 6,11}},
+	{{ 53,116},{ 6,11}}, {{ 53,116},{ 6,11}}, {{ 53, 32},{ 6,12}},
+	{{ 53, 37},{ 6,12}}, {{ 53, 45},{ 6,12}}, {{ 53, 46},{ 6,12}},
+	{{ 53, 47},{ 6,12}}, {{ 53, 51},{ 6,12}}, {{ 53, 52},{ 6,12}},
+	{{ 53, 53},{ 6,12}}, {{ 53, 54},{ 6,12}}, {{ 53, 55},{ 6,12}},
+	{{ 53, 56},{ 6,12}}, {{ 53, 57},{ 6,12}}, {{ 53, 61},{ 6,12}},
+	{{ 53, 65},{ 6,12}}, {{ 53, 95},{ 6,12}}, {{ 53, 98},{ 6,12}},
+	{{ 53,100},{ 6,12}}, {{ 53,102},{ 6,12}}, {{ 53,103},{ 6,12}},
+	{{ 53,104},{ 6,12}}, {{ 53,108},{ 6,12}}, {{ 53,109},{ 6,12}},
+	{{ 53,110},{ 6,12}}, {{ 53,112},{ 6,12}}, {{ 53,114},{ 6,12}},
+	{{ 53,117},{ 6,12}}, {{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}},
+	{{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}},
+	{{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}},
+	{{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}},
+	{{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}},
+	{{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}}, {{ 53,  0},{ 6, 0}},
+	{{ 53,  0},{ 6, 0}}, {{ 54, 48},{ 6,11}}, {{ 54, 48},{ 6,11}},
+	{{ 54, 49},{ 6,11}}, {{ 54, 49},{ 6,11}}, {{ 54, 50},{ 6,11}},
+	{{ 54, 50},{ 6,11}}, {{ 54, 97},{ 6,11}}, {{ 54, 97},{ 6,11}},
+	{{ 54, 99},{ 6,11}}, {{ 54, 99},{ 6,11}}, {{ 54,101},{ 6,11}},
+	{{ 54,101},{ 6,11}}, {{ 54,105},{ 6,11}}, {{ 54,105},{ 6,11}},
+	{{ 54,111},{ 6,11}}, {{ 54,111},{ 6,11}}, {{ 54,115},{ 6,11}},
+	{{ 54,115},{ 6,11}}, {{ 54,116},{ 6,11}}, {{ 54,116},{ 6,11}},
+	{{ 54, 32},{ 6,12}}, {{ 54, 37},{ 6,12}}, {{ 54, 45},{ 6,12}},
+	{{ 54, 46},{ 6,12}}, {{ 54, 47},{ 6,12}}, {{ 54, 51},{ 6,12}},
+	{{ 54, 52},{ 6,12}}, {{ 54, 53},{ 6,12}}, {{ 54, 54},{ 6,12}},
+	{{ 54, 55},{ 6,12}}, {{ 54, 56},{ 6,12}}, {{ 54, 57},{ 6,12}},
+	{{ 54, 61},{ 6,12}}, {{ 54, 65},{ 6,12}}, {{ 54, 95},{ 6,12}},
+	{{ 54, 98},{ 6,12}}, {{ 54,100},{ 6,12}}, {{ 54,102},{ 6,12}},
+	{{ 54,103},{ 6,12}}, {{ 54,104},{ 6,12}}, {{ 54,108},{ 6,12}},
+	{{ 54,109},{ 6,12}}, {{ 54,110},{ 6,12}}, {{ 54,112},{ 6,12}},
+	{{ 54,114},{ 6,12}}, {{ 54,117},{ 6,12}}, {{ 54,  0},{ 6, 0}},
+	{{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}},
+	{{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}},
+	{{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}},
+	{{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}},
+	{{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}},
+	{{ 54,  0},{ 6, 0}}, {{ 54,  0},{ 6, 0}}, {{ 55, 48},{ 6,11}},
+	{{ 55, 48},{ 6,11}}, {{ 55, 49},{ 6,11}}, {{ 55, 49},{ 6,11}},
+	{{ 55, 50},{ 6,11}}, {{ 55, 50},{ 6,11}}, {{ 55, 97},{ 6,11}},
+	{{ 55, 97},{ 6,11}}, {{ 55, 99},{ 6,11}}, {{ 55, 99},{ 6,11}},
+	{{ 55,101},{ 6,11}}, {{ 55,101},{ 6,11}}, {{ 55,105},{ 6,11}},
+	{{ 55,105},{ 6,11}}, {{ 55,111},{ 6,11}}, {{ 55,111},{ 6,11}},
+	{{ 55,115},{ 6,11}}, {{ 55,115},{ 6,11}}, {{ 55,116},{ 6,11}},
+	{{ 55,116},{ 6,11}}, {{ 55, 32},{ 6,12}}, {{ 55, 37},{ 6,12}},
+	{{ 55, 45},{ 6,12}}, {{ 55, 46},{ 6,12}}, {{ 55, 47},{ 6,12}},
+	{{ 55, 51},{ 6,12}}, {{ 55, 52},{ 6,12}}, {{ 55, 53},{ 6,12}},
+	{{ 55, 54},{ 6,12}}, {{ 55, 55},{ 6,12}}, {{ 55, 56},{ 6,12}},
+	{{ 55, 57},{ 6,12}}, {{ 55, 61},{ 6,12}}, {{ 55, 65},{ 6,12}},
+	{{ 55, 95},{ 6,12}}, {{ 55, 98},{ 6,12}}, {{ 55,100},{ 6,12}},
+	{{ 55,102},{ 6,12}}, {{ 55,103},{ 6,12}}, {{ 55,104},{ 6,12}},
+	{{ 55,108},{ 6,12}}, {{ 55,109},{ 6,12}}, {{ 55,110},{ 6,12}},
+	{{ 55,112},{ 6,12}}, {{ 55,114},{ 6,12}}, {{ 55,117},{ 6,12}},
+	{{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}},
+	{{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}},
+	{{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}},
+	{{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}},
+	{{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}},
+	{{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}}, {{ 55,  0},{ 6, 0}},
+	{{ 56, 48},{ 6,11}}, {{ 56, 48},{ 6,11}}, {{ 56, 49},{ 6,11}},
+	{{ 56, 49},{ 6,11}}, {{ 56, 50},{ 6,11}}, {{ 56, 50},{ 6,11}},
+	{{ 56, 97},{ 6,11}}, {{ 56, 97},{ 6,11}}, {{ 56, 99},{ 6,11}},
+	{{ 56, 99},{ 6,11}}, {{ 56,101},{ 6,11}}, {{ 56,101},{ 6,11}},
+	{{ 56,105},{ 6,11}}, {{ 56,105},{ 6,11}}, {{ 56,111},{ 6,11}},
+	{{ 56,111},{ 6,11}}, {{ 56,115},{ 6,11}}, {{ 56,115},{ 6,11}},
+	{{ 56,116},{ 6,11}}, {{ 56,116},{ 6,11}}, {{ 56, 32},{ 6,12}},
+	{{ 56, 37},{ 6,12}}, {{ 56, 45},{ 6,12}}, {{ 56, 46},{ 6,12}},
+	{{ 56, 47},{ 6,12}}, {{ 56, 51},{ 6,12}}, {{ 56, 52},{ 6,12}},
+	{{ 56, 53},{ 6,12}}, {{ 56, 54},{ 6,12}}, {{ 56, 55},{ 6,12}},
+	{{ 56, 56},{ 6,12}}, {{ 56, 57},{ 6,12}}, {{ 56, 61},{ 6,12}},
+	{{ 56, 65},{ 6,12}}, {{ 56, 95},{ 6,12}}, {{ 56, 98},{ 6,12}},
+	{{ 56,100},{ 6,12}}, {{ 56,102},{ 6,12}}, {{ 56,103},{ 6,12}},
+	{{ 56,104},{ 6,12}}, {{ 56,108},{ 6,12}}, {{ 56,109},{ 6,12}},
+	{{ 56,110},{ 6,12}}, {{ 56,112},{ 6,12}}, {{ 56,114},{ 6,12}},
+	{{ 56,117},{ 6,12}}, {{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}},
+	{{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}},
+	{{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}},
+	{{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}},
+	{{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}},
+	{{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}}, {{ 56,  0},{ 6, 0}},
+	{{ 56,  0},{ 6, 0}}, {{ 57, 48},{ 6,11}}, {{ 57, 48},{ 6,11}},
+	{{ 57, 49},{ 6,11}}, {{ 57, 49},{ 6,11}}, {{ 57, 50},{ 6,11}},
+	{{ 57, 50},{ 6,11}}, {{ 57, 97},{ 6,11}}, {{ 57, 97},{ 6,11}},
+	{{ 57, 99},{ 6,11}}, {{ 57, 99},{ 6,11}}, {{ 57,101},{ 6,11}},
+	{{ 57,101},{ 6,11}}, {{ 57,105},{ 6,11}}, {{ 57,105},{ 6,11}},
+	{{ 57,111},{ 6,11}}, {{ 57,111},{ 6,11}}, {{ 57,115},{ 6,11}},
+	{{ 57,115},{ 6,11}}, {{ 57,116},{ 6,11}}, {{ 57,116},{ 6,11}},
+	{{ 57, 32},{ 6,12}}, {{ 57, 37},{ 6,12}}, {{ 57, 45},{ 6,12}},
+	{{ 57, 46},{ 6,12}}, {{ 57, 47},{ 6,12}}, {{ 57, 51},{ 6,12}},
+	{{ 57, 52},{ 6,12}}, {{ 57, 53},{ 6,12}}, {{ 57, 54},{ 6,12}},
+	{{ 57, 55},{ 6,12}}, {{ 57, 56},{ 6,12}}, {{ 57, 57},{ 6,12}},
+	{{ 57, 61},{ 6,12}}, {{ 57, 65},{ 6,12}}, {{ 57, 95},{ 6,12}},
+	{{ 57, 98},{ 6,12}}, {{ 57,100},{ 6,12}}, {{ 57,102},{ 6,12}},
+	{{ 57,103},{ 6,12}}, {{ 57,104},{ 6,12}}, {{ 57,108},{ 6,12}},
+	{{ 57,109},{ 6,12}}, {{ 57,110},{ 6,12}}, {{ 57,112},{ 6,12}},
+	{{ 57,114},{ 6,12}}, {{ 57,117},{ 6,12}}, {{ 57,  0},{ 6, 0}},
+	{{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}},
+	{{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}},
+	{{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}},
+	{{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}},
+	{{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}},
+	{{ 57,  0},{ 6, 0}}, {{ 57,  0},{ 6, 0}}, {{ 61, 48},{ 6,11}},
+	{{ 61, 48},{ 6,11}}, {{ 61, 49},{ 6,11}}, {{ 61, 49},{ 6,11}},
+	{{ 61, 50},{ 6,11}}, {{ 61, 50},{ 6,11}}, {{ 61, 97},{ 6,11}},
+	{{ 61, 97},{ 6,11}}, {{ 61, 99},{ 6,11}}, {{ 61, 99},{ 6,11}},
+	{{ 61,101},{ 6,11}}, {{ 61,101},{ 6,11}}, {{ 61,105},{ 6,11}},
+	{{ 61,105},{ 6,11}}, {{ 61,111},{ 6,11}}, {{ 61,111},{ 6,11}},
+	{{ 61,115},{ 6,11}}, {{ 61,115},{ 6,11}}, {{ 61,116},{ 6,11}},
+	{{ 61,116},{ 6,11}}, {{ 61, 32},{ 6,12}}, {{ 61, 37},{ 6,12}},
+	{{ 61, 45},{ 6,12}}, {{ 61, 46},{ 6,12}}, {{ 61, 47},{ 6,12}},
+	{{ 61, 51},{ 6,12}}, {{ 61, 52},{ 6,12}}, {{ 61, 53},{ 6,12}},
+	{{ 61, 54},{ 6,12}}, {{ 61, 55},{ 6,12}}, {{ 61, 56},{ 6,12}},
+	{{ 61, 57},{ 6,12}}, {{ 61, 61},{ 6,12}}, {{ 61, 65},{ 6,12}},
+	{{ 61, 95},{ 6,12}}, {{ 61, 98},{ 6,12}}, {{ 61,100},{ 6,12}},
+	{{ 61,102},{ 6,12}}, {{ 61,103},{ 6,12}}, {{ 61,104},{ 6,12}},
+	{{ 61,108},{ 6,12}}, {{ 61,109},{ 6,12}}, {{ 61,110},{ 6,12}},
+	{{ 61,112},{ 6,12}}, {{ 61,114},{ 6,12}}, {{ 61,117},{ 6,12}},
+	{{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}},
+	{{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}},
+	{{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}},
+	{{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}},
+	{{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}},
+	{{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}}, {{ 61,  0},{ 6, 0}},
+	{{ 65, 48},{ 6,11}}, {{ 65, 48},{ 6,11}}, {{ 65, 49},{ 6,11}},
+	{{ 65, 49},{ 6,11}}, {{ 65, 50},{ 6,11}}, {{ 65, 50},{ 6,11}},
+	{{ 65, 97},{ 6,11}}, {{ 65, 97},{ 6,11}}, {{ 65, 99},{ 6,11}},
+	{{ 65, 99},{ 6,11}}, {{ 65,101},{ 6,11}}, {{ 65,101},{ 6,11}},
+	{{ 65,105},{ 6,11}}, {{ 65,105},{ 6,11}}, {{ 65,111},{ 6,11}},
+	{{ 65,111},{ 6,11}}, {{ 65,115},{ 6,11}}, {{ 65,115},{ 6,11}},
+	{{ 65,116},{ 6,11}}, {{ 65,116},{ 6,11}}, {{ 65, 32},{ 6,12}},
+	{{ 65, 37},{ 6,12}}, {{ 65, 45},{ 6,12}}, {{ 65, 46},{ 6,12}},
+	{{ 65, 47},{ 6,12}}, {{ 65, 51},{ 6,12}}, {{ 65, 52},{ 6,12}},
+	{{ 65, 53},{ 6,12}}, {{ 65, 54},{ 6,12}}, {{ 65, 55},{ 6,12}},
+	{{ 65, 56},{ 6,12}}, {{ 65, 57},{ 6,12}}, {{ 65, 61},{ 6,12}},
+	{{ 65, 65},{ 6,12}}, {{ 65, 95},{ 6,12}}, {{ 65, 98},{ 6,12}},
+	{{ 65,100},{ 6,12}}, {{ 65,102},{ 6,12}}, {{ 65,103},{ 6,12}},
+	{{ 65,104},{ 6,12}}, {{ 65,108},{ 6,12}}, {{ 65,109},{ 6,12}},
+	{{ 65,110},{ 6,12}}, {{ 65,112},{ 6,12}}, {{ 65,114},{ 6,12}},
+	{{ 65,117},{ 6,12}}, {{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}},
+	{{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}},
+	{{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}},
+	{{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}},
+	{{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}},
+	{{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}}, {{ 65,  0},{ 6, 0}},
+	{{ 65,  0},{ 6, 0}}, {{ 95, 48},{ 6,11}}, {{ 95, 48},{ 6,11}},
+	{{ 95, 49},{ 6,11}}, {{ 95, 49},{ 6,11}}, {{ 95, 50},{ 6,11}},
+	{{ 95, 50},{ 6,11}}, {{ 95, 97},{ 6,11}}, {{ 95, 97},{ 6,11}},
+	{{ 95, 99},{ 6,11}}, {{ 95, 99},{ 6,11}}, {{ 95,101},{ 6,11}},
+	{{ 95,101},{ 6,11}}, {{ 95,105},{ 6,11}}, {{ 95,105},{ 6,11}},
+	{{ 95,111},{ 6,11}}, {{ 95,111},{ 6,11}}, {{ 95,115},{ 6,11}},
+	{{ 95,115},{ 6,11}}, {{ 95,116},{ 6,11}}, {{ 95,116},{ 6,11}},
+	{{ 95, 32},{ 6,12}}, {{ 95, 37},{ 6,12}}, {{ 95, 45},{ 6,12}},
+	{{ 95, 46},{ 6,12}}, {{ 95, 47},{ 6,12}}, {{ 95, 51},{ 6,12}},
+	{{ 95, 52},{ 6,12}}, {{ 95, 53},{ 6,12}}, {{ 95, 54},{ 6,12}},
+	{{ 95, 55},{ 6,12}}, {{ 95, 56},{ 6,12}}, {{ 95, 57},{ 6,12}},
+	{{ 95, 61},{ 6,12}}, {{ 95, 65},{ 6,12}}, {{ 95, 95},{ 6,12}},
+	{{ 95, 98},{ 6,12}}, {{ 95,100},{ 6,12}}, {{ 95,102},{ 6,12}},
+	{{ 95,103},{ 6,12}}, {{ 95,104},{ 6,12}}, {{ 95,108},{ 6,12}},
+	{{ 95,109},{ 6,12}}, {{ 95,110},{ 6,12}}, {{ 95,112},{ 6,12}},
+	{{ 95,114},{ 6,12}}, {{ 95,117},{ 6,12}}, {{ 95,  0},{ 6, 0}},
+	{{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}},
+	{{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}},
+	{{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}},
+	{{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}},
+	{{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}},
+	{{ 95,  0},{ 6, 0}}, {{ 95,  0},{ 6, 0}}, {{ 98, 48},{ 6,11}},
+	{{ 98, 48},{ 6,11}}, {{ 98, 49},{ 6,11}}, {{ 98, 49},{ 6,11}},
+	{{ 98, 50},{ 6,11}}, {{ 98, 50},{ 6,11}}, {{ 98, 97},{ 6,11}},
+	{{ 98, 97},{ 6,11}}, {{ 98, 99},{ 6,11}}, {{ 98, 99},{ 6,11}},
+	{{ 98,101},{ 6,11}}, {{ 98,101},{ 6,11}}, {{ 98,105},{ 6,11}},
+	{{ 98,105},{ 6,11}}, {{ 98,111},{ 6,11}}, {{ 98,111},{ 6,11}},
+	{{ 98,115},{ 6,11}}, {{ 98,115},{ 6,11}}, {{ 98,116},{ 6,11}},
+	{{ 98,116},{ 6,11}}, {{ 98, 32},{ 6,12}}, {{ 98, 37},{ 6,12}},
+	{{ 98, 45},{ 6,12}}, {{ 98, 46},{ 6,12}}, {{ 98, 47},{ 6,12}},
+	{{ 98, 51},{ 6,12}}, {{ 98, 52},{ 6,12}}, {{ 98, 53},{ 6,12}},
+	{{ 98, 54},{ 6,12}}, {{ 98, 55},{ 6,12}}, {{ 98, 56},{ 6,12}},
+	{{ 98, 57},{ 6,12}}, {{ 98, 61},{ 6,12}}, {{ 98, 65},{ 6,12}},
+	{{ 98, 95},{ 6,12}}, {{ 98, 98},{ 6,12}}, {{ 98,100},{ 6,12}},
+	{{ 98,102},{ 6,12}}, {{ 98,103},{ 6,12}}, {{ 98,104},{ 6,12}},
+	{{ 98,108},{ 6,12}}, {{ 98,109},{ 6,12}}, {{ 98,110},{ 6,12}},
+	{{ 98,112},{ 6,12}}, {{ 98,114},{ 6,12}}, {{ 98,117},{ 6,12}},
+	{{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}},
+	{{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}},
+	{{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}},
+	{{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}},
+	{{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}},
+	{{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}}, {{ 98,  0},{ 6, 0}},
+	{{100, 48},{ 6,11}}, {{100, 48},{ 6,11}}, {{100, 49},{ 6,11}},
+	{{100, 49},{ 6,11}}, {{100, 50},{ 6,11}}, {{100, 50},{ 6,11}},
+	{{100, 97},{ 6,11}}, {{100, 97},{ 6,11}}, {{100, 99},{ 6,11}},
+	{{100, 99},{ 6,11}}, {{100,101},{ 6,11}}, {{100,101},{ 6,11}},
+	{{100,105},{ 6,11}}, {{100,105},{ 6,11}}, {{100,111},{ 6,11}},
+	{{100,111},{ 6,11}}, {{100,115},{ 6,11}}, {{100,115},{ 6,11}},
+	{{100,116},{ 6,11}}, {{100,116},{ 6,11}}, {{100, 32},{ 6,12}},
+	{{100, 37},{ 6,12}}, {{100, 45},{ 6,12}}, {{100, 46},{ 6,12}},
+	{{100, 47},{ 6,12}}, {{100, 51},{ 6,12}}, {{100, 52},{ 6,12}},
+	{{100, 53},{ 6,12}}, {{100, 54},{ 6,12}}, {{100, 55},{ 6,12}},
+	{{100, 56},{ 6,12}}, {{100, 57},{ 6,12}}, {{100, 61},{ 6,12}},
+	{{100, 65},{ 6,12}}, {{100, 95},{ 6,12}}, {{100, 98},{ 6,12}},
+	{{100,100},{ 6,12}}, {{100,102},{ 6,12}}, {{100,103},{ 6,12}},
+	{{100,104},{ 6,12}}, {{100,108},{ 6,12}}, {{100,109},{ 6,12}},
+	{{100,110},{ 6,12}}, {{100,112},{ 6,12}}, {{100,114},{ 6,12}},
+	{{100,117},{ 6,12}}, {{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}},
+	{{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}},
+	{{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}},
+	{{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}},
+	{{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}},
+	{{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}}, {{100,  0},{ 6, 0}},
+	{{100,  0},{ 6, 0}}, {{102, 48},{ 6,11}}, {{102, 48},{ 6,11}},
+	{{102, 49},{ 6,11}}, {{102, 49},{ 6,11}}, {{102, 50},{ 6,11}},
+	{{102, 50},{ 6,11}}, {{102, 97},{ 6,11}}, {{102, 97},{ 6,11}},
+	{{102, 99},{ 6,11}}, {{102, 99},{ 6,11}}, {{102,101},{ 6,11}},
+	{{102,101},{ 6,11}}, {{102,105},{ 6,11}}, {{102,105},{ 6,11}},
+	{{102,111},{ 6,11}}, {{102,111},{ 6,11}}, {{102,115},{ 6,11}},
+	{{102,115},{ 6,11}}, {{102,116},{ 6,11}}, {{102,116},{ 6,11}},
+	{{102, 32},{ 6,12}}, {{102, 37},{ 6,12}}, {{102, 45},{ 6,12}},
+	{{102, 46},{ 6,12}}, {{102, 47},{ 6,12}}, {{102, 51},{ 6,12}},
+	{{102, 52},{ 6,12}}, {{102, 53},{ 6,12}}, {{102, 54},{ 6,12}},
+	{{102, 55},{ 6,12}}, {{102, 56},{ 6,12}}, {{102, 57},{ 6,12}},
+	{{102, 61},{ 6,12}}, {{102, 65},{ 6,12}}, {{102, 95},{ 6,12}},
+	{{102, 98},{ 6,12}}, {{102,100},{ 6,12}}, {{102,102},{ 6,12}},
+	{{102,103},{ 6,12}}, {{102,104},{ 6,12}}, {{102,108},{ 6,12}},
+	{{102,109},{ 6,12}}, {{102,110},{ 6,12}}, {{102,112},{ 6,12}},
+	{{102,114},{ 6,12}}, {{102,117},{ 6,12}}, {{102,  0},{ 6, 0}},
+	{{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}},
+	{{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}},
+	{{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}},
+	{{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}},
+	{{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}},
+	{{102,  0},{ 6, 0}}, {{102,  0},{ 6, 0}}, {{103, 48},{ 6,11}},
+	{{103, 48},{ 6,11}}, {{103, 49},{ 6,11}}, {{103, 49},{ 6,11}},
+	{{103, 50},{ 6,11}}, {{103, 50},{ 6,11}}, {{103, 97},{ 6,11}},
+	{{103, 97},{ 6,11}}, {{103, 99},{ 6,11}}, {{103, 99},{ 6,11}},
+	{{103,101},{ 6,11}}, {{103,101},{ 6,11}}, {{103,105},{ 6,11}},
+	{{103,105},{ 6,11}}, {{103,111},{ 6,11}}, {{103,111},{ 6,11}},
+	{{103,115},{ 6,11}}, {{103,115},{ 6,11}}, {{103,116},{ 6,11}},
+	{{103,116},{ 6,11}}, {{103, 32},{ 6,12}}, {{103, 37},{ 6,12}},
+	{{103, 45},{ 6,12}}, {{103, 46},{ 6,12}}, {{103, 47},{ 6,12}},
+	{{103, 51},{ 6,12}}, {{103, 52},{ 6,12}}, {{103, 53},{ 6,12}},
+	{{103, 54},{ 6,12}}, {{103, 55},{ 6,12}}, {{103, 56},{ 6,12}},
+	{{103, 57},{ 6,12}}, {{103, 61},{ 6,12}}, {{103, 65},{ 6,12}},
+	{{103, 95},{ 6,12}}, {{103, 98},{ 6,12}}, {{103,100},{ 6,12}},
+	{{103,102},{ 6,12}}, {{103,103},{ 6,12}}, {{103,104},{ 6,12}},
+	{{103,108},{ 6,12}}, {{103,109},{ 6,12}}, {{103,110},{ 6,12}},
+	{{103,112},{ 6,12}}, {{103,114},{ 6,12}}, {{103,117},{ 6,12}},
+	{{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}},
+	{{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}},
+	{{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}},
+	{{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}},
+	{{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}},
+	{{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}}, {{103,  0},{ 6, 0}},
+	{{104, 48},{ 6,11}}, {{104, 48},{ 6,11}}, {{104, 49},{ 6,11}},
+	{{104, 49},{ 6,11}}, {{104, 50},{ 6,11}}, {{104, 50},{ 6,11}},
+	{{104, 97},{ 6,11}}, {{104, 97},{ 6,11}}, {{104, 99},{ 6,11}},
+	{{104, 99},{ 6,11}}, {{104,101},{ 6,11}}, {{104,101},{ 6,11}},
+	{{104,105},{ 6,11}}, {{104,105},{ 6,11}}, {{104,111},{ 6,11}},
+	{{104,111},{ 6,11}}, {{104,115},{ 6,11}}, {{104,115},{ 6,11}},
+	{{104,116},{ 6,11}}, {{104,116},{ 6,11}}, {{104, 32},{ 6,12}},
+	{{104, 37},{ 6,12}}, {{104, 45},{ 6,12}}, {{104, 46},{ 6,12}},
+	{{104, 47},{ 6,12}}, {{104, 51},{ 6,12}}, {{104, 52},{ 6,12}},
+	{{104, 53},{ 6,12}}, {{104, 54},{ 6,12}}, {{104, 55},{ 6,12}},
+	{{104, 56},{ 6,12}}, {{104, 57},{ 6,12}}, {{104, 61},{ 6,12}},
+	{{104, 65},{ 6,12}}, {{104, 95},{ 6,12}}, {{104, 98},{ 6,12}},
+	{{104,100},{ 6,12}}, {{104,102},{ 6,12}}, {{104,103},{ 6,12}},
+	{{104,104},{ 6,12}}, {{104,108},{ 6,12}}, {{104,109},{ 6,12}},
+	{{104,110},{ 6,12}}, {{104,112},{ 6,12}}, {{104,114},{ 6,12}},
+	{{104,117},{ 6,12}}, {{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}},
+	{{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}},
+	{{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}},
+	{{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}},
+	{{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}},
+	{{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}}, {{104,  0},{ 6, 0}},
+	{{104,  0},{ 6, 0}}, {{108, 48},{ 6,11}}, {{108, 48},{ 6,11}},
+	{{108, 49},{ 6,11}}, {{108, 49},{ 6,11}}, {{108, 50},{ 6,11}},
+	{{108, 50},{ 6,11}}, {{108, 97},{ 6,11}}, {{108, 97},{ 6,11}},
+	{{108, 99},{ 6,11}}, {{108, 99},{ 6,11}}, {{108,101},{ 6,11}},
+	{{108,101},{ 6,11}}, {{108,105},{ 6,11}}, {{108,105},{ 6,11}},
+	{{108,111},{ 6,11}}, {{108,111},{ 6,11}}, {{108,115},{ 6,11}},
+	{{108,115},{ 6,11}}, {{108,116},{ 6,11}}, {{108,116},{ 6,11}},
+	{{108, 32},{ 6,12}}, {{108, 37},{ 6,12}}, {{108, 45},{ 6,12}},
+	{{108, 46},{ 6,12}}, {{108, 47},{ 6,12}}, {{108, 51},{ 6,12}},
+	{{108, 52},{ 6,12}}, {{108, 53},{ 6,12}}, {{108, 54},{ 6,12}},
+	{{108, 55},{ 6,12}}, {{108, 56},{ 6,12}}, {{108, 57},{ 6,12}},
+	{{108, 61},{ 6,12}}, {{108, 65},{ 6,12}}, {{108, 95},{ 6,12}},
+	{{108, 98},{ 6,12}}, {{108,100},{ 6,12}}, {{108,102},{ 6,12}},
+	{{108,103},{ 6,12}}, {{108,104},{ 6,12}}, {{108,108},{ 6,12}},
+	{{108,109},{ 6,12}}, {{108,110},{ 6,12}}, {{108,112},{ 6,12}},
+	{{108,114},{ 6,12}}, {{108,117},{ 6,12}}, {{108,  0},{ 6, 0}},
+	{{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}},
+	{{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}},
+	{{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}},
+	{{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}},
+	{{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}},
+	{{108,  0},{ 6, 0}}, {{108,  0},{ 6, 0}}, {{109, 48},{ 6,11}},
+	{{109, 48},{ 6,11}}, {{109, 49},{ 6,11}}, {{109, 49},{ 6,11}},
+	{{109, 50},{ 6,11}}, {{109, 50},{ 6,11}}, {{109, 97},{ 6,11}},
+	{{109, 97},{ 6,11}}, {{109, 99},{ 6,11}}, {{109, 99},{ 6,11}},
+	{{109,101},{ 6,11}}, {{109,101},{ 6,11}}, {{109,105},{ 6,11}},
+	{{109,105},{ 6,11}}, {{109,111},{ 6,11}}, {{109,111},{ 6,11}},
+	{{109,115},{ 6,11}}, {{109,115},{ 6,11}}, {{109,116},{ 6,11}},
+	{{109,116},{ 6,11}}, {{109, 32},{ 6,12}}, {{109, 37},{ 6,12}},
+	{{109, 45},{ 6,12}}, {{109, 46},{ 6,12}}, {{109, 47},{ 6,12}},
+	{{109, 51},{ 6,12}}, {{109, 52},{ 6,12}}, {{109, 53},{ 6,12}},
+	{{109, 54},{ 6,12}}, {{109, 55},{ 6,12}}, {{109, 56},{ 6,12}},
+	{{109, 57},{ 6,12}}, {{109, 61},{ 6,12}}, {{109, 65},{ 6,12}},
+	{{109, 95},{ 6,12}}, {{109, 98},{ 6,12}}, {{109,100},{ 6,12}},
+	{{109,102},{ 6,12}}, {{109,103},{ 6,12}}, {{109,104},{ 6,12}},
+	{{109,108},{ 6,12}}, {{109,109},{ 6,12}}, {{109,110},{ 6,12}},
+	{{109,112},{ 6,12}}, {{109,114},{ 6,12}}, {{109,117},{ 6,12}},
+	{{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}},
+	{{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}},
+	{{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}},
+	{{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}},
+	{{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}},
+	{{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}}, {{109,  0},{ 6, 0}},
+	{{110, 48},{ 6,11}}, {{110, 48},{ 6,11}}, {{110, 49},{ 6,11}},
+	{{110, 49},{ 6,11}}, {{110, 50},{ 6,11}}, {{110, 50},{ 6,11}},
+	{{110, 97},{ 6,11}}, {{110, 97},{ 6,11}}, {{110, 99},{ 6,11}},
+	{{110, 99},{ 6,11}}, {{110,101},{ 6,11}}, {{110,101},{ 6,11}},
+	{{110,105},{ 6,11}}, {{110,105},{ 6,11}}, {{110,111},{ 6,11}},
+	{{110,111},{ 6,11}}, {{110,115},{ 6,11}}, {{110,115},{ 6,11}},
+	{{110,116},{ 6,11}}, {{110,116},{ 6,11}}, {{110, 32},{ 6,12}},
+	{{110, 37},{ 6,12}}, {{110, 45},{ 6,12}}, {{110, 46},{ 6,12}},
+	{{110, 47},{ 6,12}}, {{110, 51},{ 6,12}}, {{110, 52},{ 6,12}},
+	{{110, 53},{ 6,12}}, {{110, 54},{ 6,12}}, {{110, 55},{ 6,12}},
+	{{110, 56},{ 6,12}}, {{110, 57},{ 6,12}}, {{110, 61},{ 6,12}},
+	{{110, 65},{ 6,12}}, {{110, 95},{ 6,12}}, {{110, 98},{ 6,12}},
+	{{110,100},{ 6,12}}, {{110,102},{ 6,12}}, {{110,103},{ 6,12}},
+	{{110,104},{ 6,12}}, {{110,108},{ 6,12}}, {{110,109},{ 6,12}},
+	{{110,110},{ 6,12}}, {{110,112},{ 6,12}}, {{110,114},{ 6,12}},
+	{{110,117},{ 6,12}}, {{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}},
+	{{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}},
+	{{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}},
+	{{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}},
+	{{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}},
+	{{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}}, {{110,  0},{ 6, 0}},
+	{{110,  0},{ 6, 0}}, {{112, 48},{ 6,11}}, {{112, 48},{ 6,11}},
+	{{112, 49},{ 6,11}}, {{112, 49},{ 6,11}}, {{112, 50},{ 6,11}},
+	{{112, 50},{ 6,11}}, {{112, 97},{ 6,11}}, {{112, 97},{ 6,11}},
+	{{112, 99},{ 6,11}}, {{112, 99},{ 6,11}}, {{112,101},{ 6,11}},
+	{{112,101},{ 6,11}}, {{112,105},{ 6,11}}, {{112,105},{ 6,11}},
+	{{112,111},{ 6,11}}, {{112,111},{ 6,11}}, {{112,115},{ 6,11}},
+	{{112,115},{ 6,11}}, {{112,116},{ 6,11}}, {{112,116},{ 6,11}},
+	{{112, 32},{ 6,12}}, {{112, 37},{ 6,12}}, {{112, 45},{ 6,12}},
+	{{112, 46},{ 6,12}}, {{112, 47},{ 6,12}}, {{112, 51},{ 6,12}},
+	{{112, 52},{ 6,12}}, {{112, 53},{ 6,12}}, {{112, 54},{ 6,12}},
+	{{112, 55},{ 6,12}}, {{112, 56},{ 6,12}}, {{112, 57},{ 6,12}},
+	{{112, 61},{ 6,12}}, {{112, 65},{ 6,12}}, {{112, 95},{ 6,12}},
+	{{112, 98},{ 6,12}}, {{112,100},{ 6,12}}, {{112,102},{ 6,12}},
+	{{112,103},{ 6,12}}, {{112,104},{ 6,12}}, {{112,108},{ 6,12}},
+	{{112,109},{ 6,12}}, {{112,110},{ 6,12}}, {{112,112},{ 6,12}},
+	{{112,114},{ 6,12}}, {{112,117},{ 6,12}}, {{112,  0},{ 6, 0}},
+	{{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}},
+	{{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}},
+	{{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}},
+	{{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}},
+	{{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}},
+	{{112,  0},{ 6, 0}}, {{112,  0},{ 6, 0}}, {{114, 48},{ 6,11}},
+	{{114, 48},{ 6,11}}, {{114, 49},{ 6,11}}, {{114, 49},{ 6,11}},
+	{{114, 50},{ 6,11}}, {{114, 50},{ 6,11}}, {{114, 97},{ 6,11}},
+	{{114, 97},{ 6,11}}, {{114, 99},{ 6,11}}, {{114, 99},{ 6,11}},
+	{{114,101},{ 6,11}}, {{114,101},{ 6,11}}, {{114,105},{ 6,11}},
+	{{114,105},{ 6,11}}, {{114,111},{ 6,11}}, {{114,111},{ 6,11}},
+	{{114,115},{ 6,11}}, {{114,115},{ 6,11}}, {{114,116},{ 6,11}},
+	{{114,116},{ 6,11}}, {{114, 32},{ 6,12}}, {{114, 37},{ 6,12}},
+	{{114, 45},{ 6,12}}, {{114, 46},{ 6,12}}, {{114, 47},{ 6,12}},
+	{{114, 51},{ 6,12}}, {{114, 52},{ 6,12}}, {{114, 53},{ 6,12}},
+	{{114, 54},{ 6,12}}, {{114, 55},{ 6,12}}, {{114, 56},{ 6,12}},
+	{{114, 57},{ 6,12}}, {{114, 61},{ 6,12}}, {{114, 65},{ 6,12}},
+	{{114, 95},{ 6,12}}, {{114, 98},{ 6,12}}, {{114,100},{ 6,12}},
+	{{114,102},{ 6,12}}, {{114,103},{ 6,12}}, {{114,104},{ 6,12}},
+	{{114,108},{ 6,12}}, {{114,109},{ 6,12}}, {{114,110},{ 6,12}},
+	{{114,112},{ 6,12}}, {{114,114},{ 6,12}}, {{114,117},{ 6,12}},
+	{{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}},
+	{{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}},
+	{{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}},
+	{{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}},
+	{{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}},
+	{{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}}, {{114,  0},{ 6, 0}},
+	{{117, 48},{ 6,11}}, {{117, 48},{ 6,11}}, {{117, 49},{ 6,11}},
+	{{117, 49},{ 6,11}}, {{117, 50},{ 6,11}}, {{117, 50},{ 6,11}},
+	{{117, 97},{ 6,11}}, {{117, 97},{ 6,11}}, {{117, 99},{ 6,11}},
+	{{117, 99},{ 6,11}}, {{117,101},{ 6,11}}, {{117,101},{ 6,11}},
+	{{117,105},{ 6,11}}, {{117,105},{ 6,11}}, {{117,111},{ 6,11}},
+	{{117,111},{ 6,11}}, {{117,115},{ 6,11}}, {{117,115},{ 6,11}},
+	{{117,116},{ 6,11}}, {{117,116},{ 6,11}}, {{117, 32},{ 6,12}},
+	{{117, 37},{ 6,12}}, {{117, 45},{ 6,12}}, {{117, 46},{ 6,12}},
+	{{117, 47},{ 6,12}}, {{117, 51},{ 6,12}}, {{117, 52},{ 6,12}},
+	{{117, 53},{ 6,12}}, {{117, 54},{ 6,12}}, {{117, 55},{ 6,12}},
+	{{117, 56},{ 6,12}}, {{117, 57},{ 6,12}}, {{117, 61},{ 6,12}},
+	{{117, 65},{ 6,12}}, {{117, 95},{ 6,12}}, {{117, 98},{ 6,12}},
+	{{117,100},{ 6,12}}, {{117,102},{ 6,12}}, {{117,103},{ 6,12}},
+	{{117,104},{ 6,12}}, {{117,108},{ 6,12}}, {{117,109},{ 6,12}},
+	{{117,110},{ 6,12}}, {{117,112},{ 6,12}}, {{117,114},{ 6,12}},
+	{{117,117},{ 6,12}}, {{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}},
+	{{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}},
+	{{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}},
+	{{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}},
+	{{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}},
+	{{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}}, {{117,  0},{ 6, 0}},
+	{{117,  0},{ 6, 0}}, {{ 58, 48},{ 7,12}}, {{ 58, 49},{ 7,12}},
+	{{ 58, 50},{ 7,12}}, {{ 58, 97},{ 7,12}}, {{ 58, 99},{ 7,12}},
+	{{ 58,101},{ 7,12}}, {{ 58,105},{ 7,12}}, {{ 58,111},{ 7,12}},
+	{{ 58,115},{ 7,12}}, {{ 58,116},{ 7,12}}, {{ 58,  0},{ 7, 0}},
+	{{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}},
+	{{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}},
+	{{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}},
+	{{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}},
+	{{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}},
+	{{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}},
+	{{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}}, {{ 58,  0},{ 7, 0}},
+	{{ 66, 48},{ 7,12}}, {{ 66, 49},{ 7,12}}, {{ 66, 50},{ 7,12}},
+	{{ 66, 97},{ 7,12}}, {{ 66, 99},{ 7,12}}, {{ 66,101},{ 7,12}},
+	{{ 66,105},{ 7,12}}, {{ 66,111},{ 7,12}}, {{ 66,115},{ 7,12}},
+	{{ 66,116},{ 7,12}}, {{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}},
+	{{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}},
+	{{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}},
+	{{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}},
+	{{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}},
+	{{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}},
+	{{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}},
+	{{ 66,  0},{ 7, 0}}, {{ 66,  0},{ 7, 0}}, {{ 67, 48},{ 7,12}},
+	{{ 67, 49},{ 7,12}}, {{ 67, 50},{ 7,12}}, {{ 67, 97},{ 7,12}},
+	{{ 67, 99},{ 7,12}}, {{ 67,101},{ 7,12}}, {{ 67,105},{ 7,12}},
+	{{ 67,111},{ 7,12}}, {{ 67,115},{ 7,12}}, {{ 67,116},{ 7,12}},
+	{{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}},
+	{{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}},
+	{{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}},
+	{{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}},
+	{{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}},
+	{{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}},
+	{{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}}, {{ 67,  0},{ 7, 0}},
+	{{ 67,  0},{ 7, 0}}, {{ 68, 48},{ 7,12}}, {{ 68, 49},{ 7,12}},
+	{{ 68, 50},{ 7,12}}, {{ 68, 97},{ 7,12}}, {{ 68, 99},{ 7,12}},
+	{{ 68,101},{ 7,12}}, {{ 68,105},{ 7,12}}, {{ 68,111},{ 7,12}},
+	{{ 68,115},{ 7,12}}, {{ 68,116},{ 7,12}}, {{ 68,  0},{ 7, 0}},
+	{{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}},
+	{{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}},
+	{{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}},
+	{{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}},
+	{{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}},
+	{{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}},
+	{{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}}, {{ 68,  0},{ 7, 0}},
+	{{ 69, 48},{ 7,12}}, {{ 69, 49},{ 7,12}}, {{ 69, 50},{ 7,12}},
+	{{ 69, 97},{ 7,12}}, {{ 69, 99},{ 7,12}}, {{ 69,101},{ 7,12}},
+	{{ 69,105},{ 7,12}}, {{ 69,111},{ 7,12}}, {{ 69,115},{ 7,12}},
+	{{ 69,116},{ 7,12}}, {{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}},
+	{{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}},
+	{{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}},
+	{{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}},
+	{{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}},
+	{{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}},
+	{{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}},
+	{{ 69,  0},{ 7, 0}}, {{ 69,  0},{ 7, 0}}, {{ 70, 48},{ 7,12}},
+	{{ 70, 49},{ 7,12}}, {{ 70, 50},{ 7,12}}, {{ 70, 97},{ 7,12}},
+	{{ 70, 99},{ 7,12}}, {{ 70,101},{ 7,12}}, {{ 70,105},{ 7,12}},
+	{{ 70,111},{ 7,12}}, {{ 70,115},{ 7,12}}, {{ 70,116},{ 7,12}},
+	{{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}},
+	{{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}},
+	{{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}},
+	{{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}},
+	{{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}},
+	{{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}},
+	{{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}}, {{ 70,  0},{ 7, 0}},
+	{{ 70,  0},{ 7, 0}}, {{ 71, 48},{ 7,12}}, {{ 71, 49},{ 7,12}},
+	{{ 71, 50},{ 7,12}}, {{ 71, 97},{ 7,12}}, {{ 71, 99},{ 7,12}},
+	{{ 71,101},{ 7,12}}, {{ 71,105},{ 7,12}}, {{ 71,111},{ 7,12}},
+	{{ 71,115},{ 7,12}}, {{ 71,116},{ 7,12}}, {{ 71,  0},{ 7, 0}},
+	{{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}},
+	{{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}},
+	{{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}},
+	{{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}},
+	{{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}},
+	{{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}},
+	{{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}}, {{ 71,  0},{ 7, 0}},
+	{{ 72, 48},{ 7,12}}, {{ 72, 49},{ 7,12}}, {{ 72, 50},{ 7,12}},
+	{{ 72, 97},{ 7,12}}, {{ 72, 99},{ 7,12}}, {{ 72,101},{ 7,12}},
+	{{ 72,105},{ 7,12}}, {{ 72,111},{ 7,12}}, {{ 72,115},{ 7,12}},
+	{{ 72,116},{ 7,12}}, {{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}},
+	{{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}},
+	{{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}},
+	{{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}},
+	{{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}},
+	{{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}},
+	{{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}},
+	{{ 72,  0},{ 7, 0}}, {{ 72,  0},{ 7, 0}}, {{ 73, 48},{ 7,12}},
+	{{ 73, 49},{ 7,12}}, {{ 73, 50},{ 7,12}}, {{ 73, 97},{ 7,12}},
+	{{ 73, 99},{ 7,12}}, {{ 73,101},{ 7,12}}, {{ 73,105},{ 7,12}},
+	{{ 73,111},{ 7,12}}, {{ 73,115},{ 7,12}}, {{ 73,116},{ 7,12}},
+	{{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}},
+	{{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}},
+	{{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}},
+	{{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}},
+	{{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}},
+	{{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}},
+	{{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}}, {{ 73,  0},{ 7, 0}},
+	{{ 73,  0},{ 7, 0}}, {{ 74, 48},{ 7,12}}, {{ 74, 49},{ 7,12}},
+	{{ 74, 50},{ 7,12}}, {{ 74, 97},{ 7,12}}, {{ 74, 99},{ 7,12}},
+	{{ 74,101},{ 7,12}}, {{ 74,105},{ 7,12}}, {{ 74,111},{ 7,12}},
+	{{ 74,115},{ 7,12}}, {{ 74,116},{ 7,12}}, {{ 74,  0},{ 7, 0}},
+	{{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}},
+	{{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}},
+	{{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}},
+	{{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}},
+	{{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}},
+	{{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}},
+	{{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}}, {{ 74,  0},{ 7, 0}},
+	{{ 75, 48},{ 7,12}}, {{ 75, 49},{ 7,12}}, {{ 75, 50},{ 7,12}},
+	{{ 75, 97},{ 7,12}}, {{ 75, 99},{ 7,12}}, {{ 75,101},{ 7,12}},
+	{{ 75,105},{ 7,12}}, {{ 75,111},{ 7,12}}, {{ 75,115},{ 7,12}},
+	{{ 75,116},{ 7,12}}, {{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}},
+	{{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}},
+	{{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}},
+	{{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}},
+	{{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}},
+	{{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}},
+	{{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}},
+	{{ 75,  0},{ 7, 0}}, {{ 75,  0},{ 7, 0}}, {{ 76, 48},{ 7,12}},
+	{{ 76, 49},{ 7,12}}, {{ 76, 50},{ 7,12}}, {{ 76, 97},{ 7,12}},
+	{{ 76, 99},{ 7,12}}, {{ 76,101},{ 7,12}}, {{ 76,105},{ 7,12}},
+	{{ 76,111},{ 7,12}}, {{ 76,115},{ 7,12}}, {{ 76,116},{ 7,12}},
+	{{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}},
+	{{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}},
+	{{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}},
+	{{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}},
+	{{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}},
+	{{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}},
+	{{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}}, {{ 76,  0},{ 7, 0}},
+	{{ 76,  0},{ 7, 0}}, {{ 77, 48},{ 7,12}}, {{ 77, 49},{ 7,12}},
+	{{ 77, 50},{ 7,12}}, {{ 77, 97},{ 7,12}}, {{ 77, 99},{ 7,12}},
+	{{ 77,101},{ 7,12}}, {{ 77,105},{ 7,12}}, {{ 77,111},{ 7,12}},
+	{{ 77,115},{ 7,12}}, {{ 77,116},{ 7,12}}, {{ 77,  0},{ 7, 0}},
+	{{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}},
+	{{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}},
+	{{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}},
+	{{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}},
+	{{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}},
+	{{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}},
+	{{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}}, {{ 77,  0},{ 7, 0}},
+	{{ 78, 48},{ 7,12}}, {{ 78, 49},{ 7,12}}, {{ 78, 50},{ 7,12}},
+	{{ 78, 97},{ 7,12}}, {{ 78, 99},{ 7,12}}, {{ 78,101},{ 7,12}},
+	{{ 78,105},{ 7,12}}, {{ 78,111},{ 7,12}}, {{ 78,115},{ 7,12}},
+	{{ 78,116},{ 7,12}}, {{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}},
+	{{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}},
+	{{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}},
+	{{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}},
+	{{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}},
+	{{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}},
+	{{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}},
+	{{ 78,  0},{ 7, 0}}, {{ 78,  0},{ 7, 0}}, {{ 79, 48},{ 7,12}},
+	{{ 79, 49},{ 7,12}}, {{ 79, 50},{ 7,12}}, {{ 79, 97},{ 7,12}},
+	{{ 79, 99},{ 7,12}}, {{ 79,101},{ 7,12}}, {{ 79,105},{ 7,12}},
+	{{ 79,111},{ 7,12}}, {{ 79,115},{ 7,12}}, {{ 79,116},{ 7,12}},
+	{{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}},
+	{{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}},
+	{{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}},
+	{{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}},
+	{{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}},
+	{{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}},
+	{{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}}, {{ 79,  0},{ 7, 0}},
+	{{ 79,  0},{ 7, 0}}, {{ 80, 48},{ 7,12}}, {{ 80, 49},{ 7,12}},
+	{{ 80, 50},{ 7,12}}, {{ 80, 97},{ 7,12}}, {{ 80, 99},{ 7,12}},
+	{{ 80,101},{ 7,12}}, {{ 80,105},{ 7,12}}, {{ 80,111},{ 7,12}},
+	{{ 80,115},{ 7,12}}, {{ 80,116},{ 7,12}}, {{ 80,  0},{ 7, 0}},
+	{{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}},
+	{{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}},
+	{{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}},
+	{{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}},
+	{{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}},
+	{{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}},
+	{{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}}, {{ 80,  0},{ 7, 0}},
+	{{ 81, 48},{ 7,12}}, {{ 81, 49},{ 7,12}}, {{ 81, 50},{ 7,12}},
+	{{ 81, 97},{ 7,12}}, {{ 81, 99},{ 7,12}}, {{ 81,101},{ 7,12}},
+	{{ 81,105},{ 7,12}}, {{ 81,111},{ 7,12}}, {{ 81,115},{ 7,12}},
+	{{ 81,116},{ 7,12}}, {{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}},
+	{{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}},
+	{{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}},
+	{{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}},
+	{{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}},
+	{{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}},
+	{{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}},
+	{{ 81,  0},{ 7, 0}}, {{ 81,  0},{ 7, 0}}, {{ 82, 48},{ 7,12}},
+	{{ 82, 49},{ 7,12}}, {{ 82, 50},{ 7,12}}, {{ 82, 97},{ 7,12}},
+	{{ 82, 99},{ 7,12}}, {{ 82,101},{ 7,12}}, {{ 82,105},{ 7,12}},
+	{{ 82,111},{ 7,12}}, {{ 82,115},{ 7,12}}, {{ 82,116},{ 7,12}},
+	{{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}},
+	{{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}},
+	{{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}},
+	{{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}},
+	{{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}},
+	{{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}},
+	{{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}}, {{ 82,  0},{ 7, 0}},
+	{{ 82,  0},{ 7, 0}}, {{ 83, 48},{ 7,12}}, {{ 83, 49},{ 7,12}},
+	{{ 83, 50},{ 7,12}}, {{ 83, 97},{ 7,12}}, {{ 83, 99},{ 7,12}},
+	{{ 83,101},{ 7,12}}, {{ 83,105},{ 7,12}}, {{ 83,111},{ 7,12}},
+	{{ 83,115},{ 7,12}}, {{ 83,116},{ 7,12}}, {{ 83,  0},{ 7, 0}},
+	{{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}},
+	{{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}},
+	{{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}},
+	{{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}},
+	{{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}},
+	{{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}},
+	{{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}}, {{ 83,  0},{ 7, 0}},
+	{{ 84, 48},{ 7,12}}, {{ 84, 49},{ 7,12}}, {{ 84, 50},{ 7,12}},
+	{{ 84, 97},{ 7,12}}, {{ 84, 99},{ 7,12}}, {{ 84,101},{ 7,12}},
+	{{ 84,105},{ 7,12}}, {{ 84,111},{ 7,12}}, {{ 84,115},{ 7,12}},
+	{{ 84,116},{ 7,12}}, {{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}},
+	{{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}},
+	{{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}},
+	{{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}},
+	{{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}},
+	{{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}},
+	{{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}},
+	{{ 84,  0},{ 7, 0}}, {{ 84,  0},{ 7, 0}}, {{ 85, 48},{ 7,12}},
+	{{ 85, 49},{ 7,12}}, {{ 85, 50},{ 7,12}}, {{ 85, 97},{ 7,12}},
+	{{ 85, 99},{ 7,12}}, {{ 85,101},{ 7,12}}, {{ 85,105},{ 7,12}},
+	{{ 85,111},{ 7,12}}, {{ 85,115},{ 7,12}}, {{ 85,116},{ 7,12}},
+	{{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}},
+	{{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}},
+	{{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}},
+	{{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}},
+	{{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}},
+	{{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}},
+	{{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}}, {{ 85,  0},{ 7, 0}},
+	{{ 85,  0},{ 7, 0}}, {{ 86, 48},{ 7,12}}, {{ 86, 49},{ 7,12}},
+	{{ 86, 50},{ 7,12}}, {{ 86, 97},{ 7,12}}, {{ 86, 99},{ 7,12}},
+	{{ 86,101},{ 7,12}}, {{ 86,105},{ 7,12}}, {{ 86,111},{ 7,12}},
+	{{ 86,115},{ 7,12}}, {{ 86,116},{ 7,12}}, {{ 86,  0},{ 7, 0}},
+	{{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}},
+	{{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}},
+	{{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}},
+	{{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}},
+	{{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}},
+	{{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}},
+	{{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}}, {{ 86,  0},{ 7, 0}},
+	{{ 87, 48},{ 7,12}}, {{ 87, 49},{ 7,12}}, {{ 87, 50},{ 7,12}},
+	{{ 87, 97},{ 7,12}}, {{ 87, 99},{ 7,12}}, {{ 87,101},{ 7,12}},
+	{{ 87,105},{ 7,12}}, {{ 87,111},{ 7,12}}, {{ 87,115},{ 7,12}},
+	{{ 87,116},{ 7,12}}, {{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}},
+	{{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}},
+	{{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}},
+	{{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}},
+	{{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}},
+	{{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}},
+	{{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}},
+	{{ 87,  0},{ 7, 0}}, {{ 87,  0},{ 7, 0}}, {{ 89, 48},{ 7,12}},
+	{{ 89, 49},{ 7,12}}, {{ 89, 50},{ 7,12}}, {{ 89, 97},{ 7,12}},
+	{{ 89, 99},{ 7,12}}, {{ 89,101},{ 7,12}}, {{ 89,105},{ 7,12}},
+	{{ 89,111},{ 7,12}}, {{ 89,115},{ 7,12}}, {{ 89,116},{ 7,12}},
+	{{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}},
+	{{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}},
+	{{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}},
+	{{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}},
+	{{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}},
+	{{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}},
+	{{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}}, {{ 89,  0},{ 7, 0}},
+	{{ 89,  0},{ 7, 0}}, {{106, 48},{ 7,12}}, {{106, 49},{ 7,12}},
+	{{106, 50},{ 7,12}}, {{106, 97},{ 7,12}}, {{106, 99},{ 7,12}},
+	{{106,101},{ 7,12}}, {{106,105},{ 7,12}}, {{106,111},{ 7,12}},
+	{{106,115},{ 7,12}}, {{106,116},{ 7,12}}, {{106,  0},{ 7, 0}},
+	{{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}},
+	{{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}},
+	{{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}},
+	{{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}},
+	{{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}},
+	{{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}},
+	{{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}}, {{106,  0},{ 7, 0}},
+	{{107, 48},{ 7,12}}, {{107, 49},{ 7,12}}, {{107, 50},{ 7,12}},
+	{{107, 97},{ 7,12}}, {{107, 99},{ 7,12}}, {{107,101},{ 7,12}},
+	{{107,105},{ 7,12}}, {{107,111},{ 7,12}}, {{107,115},{ 7,12}},
+	{{107,116},{ 7,12}}, {{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}},
+	{{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}},
+	{{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}},
+	{{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}},
+	{{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}},
+	{{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}},
+	{{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}},
+	{{107,  0},{ 7, 0}}, {{107,  0},{ 7, 0}}, {{113, 48},{ 7,12}},
+	{{113, 49},{ 7,12}}, {{113, 50},{ 7,12}}, {{113, 97},{ 7,12}},
+	{{113, 99},{ 7,12}}, {{113,101},{ 7,12}}, {{113,105},{ 7,12}},
+	{{113,111},{ 7,12}}, {{113,115},{ 7,12}}, {{113,116},{ 7,12}},
+	{{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}},
+	{{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}},
+	{{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}},
+	{{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}},
+	{{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}},
+	{{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}},
+	{{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}}, {{113,  0},{ 7, 0}},
+	{{113,  0},{ 7, 0}}, {{118, 48},{ 7,12}}, {{118, 49},{ 7,12}},
+	{{118, 50},{ 7,12}}, {{118, 97},{ 7,12}}, {{118, 99},{ 7,12}},
+	{{118,101},{ 7,12}}, {{118,105},{ 7,12}}, {{118,111},{ 7,12}},
+	{{118,115},{ 7,12}}, {{118,116},{ 7,12}}, {{118,  0},{ 7, 0}},
+	{{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}},
+	{{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}},
+	{{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}},
+	{{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}},
+	{{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}},
+	{{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}},
+	{{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}}, {{118,  0},{ 7, 0}},
+	{{119, 48},{ 7,12}}, {{119, 49},{ 7,12}}, {{119, 50},{ 7,12}},
+	{{119, 97},{ 7,12}}, {{119, 99},{ 7,12}}, {{119,101},{ 7,12}},
+	{{119,105},{ 7,12}}, {{119,111},{ 7,12}}, {{119,115},{ 7,12}},
+	{{119,116},{ 7,12}}, {{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}},
+	{{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}},
+	{{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}},
+	{{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}},
+	{{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}},
+	{{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}},
+	{{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}},
+	{{119,  0},{ 7, 0}}, {{119,  0},{ 7, 0}}, {{120, 48},{ 7,12}},
+	{{120, 49},{ 7,12}}, {{120, 50},{ 7,12}}, {{120, 97},{ 7,12}},
+	{{120, 99},{ 7,12}}, {{120,101},{ 7,12}}, {{120,105},{ 7,12}},
+	{{120,111},{ 7,12}}, {{120,115},{ 7,12}}, {{120,116},{ 7,12}},
+	{{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}},
+	{{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}},
+	{{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}},
+	{{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}},
+	{{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}},
+	{{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}},
+	{{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}}, {{120,  0},{ 7, 0}},
+	{{120,  0},{ 7, 0}}, {{121, 48},{ 7,12}}, {{121, 49},{ 7,12}},
+	{{121, 50},{ 7,12}}, {{121, 97},{ 7,12}}, {{121, 99},{ 7,12}},
+	{{121,101},{ 7,12}}, {{121,105},{ 7,12}}, {{121,111},{ 7,12}},
+	{{121,115},{ 7,12}}, {{121,116},{ 7,12}}, {{121,  0},{ 7, 0}},
+	{{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}},
+	{{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}},
+	{{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}},
+	{{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}},
+	{{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}},
+	{{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}},
+	{{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}}, {{121,  0},{ 7, 0}},
+	{{122, 48},{ 7,12}}, {{122, 49},{ 7,12}}, {{122, 50},{ 7,12}},
+	{{122, 97},{ 7,12}}, {{122, 99},{ 7,12}}, {{122,101},{ 7,12}},
+	{{122,105},{ 7,12}}, {{122,111},{ 7,12}}, {{122,115},{ 7,12}},
+	{{122,116},{ 7,12}}, {{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}},
+	{{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}},
+	{{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}},
+	{{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}},
+	{{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}},
+	{{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}},
+	{{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}},
+	{{122,  0},{ 7, 0}}, {{122,  0},{ 7, 0}}, {{ 38,  0},{ 8, 0}},
+	{{ 38,  0},{ 8, 0}}, {{ 38,  0},{ 8, 0}}, {{ 38,  0},{ 8, 0}},
+	{{ 38,  0},{ 8, 0}}, {{ 38,  0},{ 8, 0}}, {{ 38,  0},{ 8, 0}},
+	{{ 38,  0},{ 8, 0}}, {{ 38,  0},{ 8, 0}}, {{ 38,  0},{ 8, 0}},
+	{{ 38,  0},{ 8, 0}}, {{ 38,  0},{ 8, 0}}, {{ 38,  0},{ 8, 0}},
+	{{ 38,  0},{ 8, 0}}, {{ 38,  0},{ 8, 0}}, {{ 38,  0},{ 8, 0}},
+	{{ 42,  0},{ 8, 0}}, {{ 42,  0},{ 8, 0}}, {{ 42,  0},{ 8, 0}},
+	{{ 42,  0},{ 8, 0}}, {{ 42,  0},{ 8, 0}}, {{ 42,  0},{ 8, 0}},
+	{{ 42,  0},{ 8, 0}}, {{ 42,  0},{ 8, 0}}, {{ 42,  0},{ 8, 0}},
+	{{ 42,  0},{ 8, 0}}, {{ 42,  0},{ 8, 0}}, {{ 42,  0},{ 8, 0}},
+	{{ 42,  0},{ 8, 0}}, {{ 42,  0},{ 8, 0}}, {{ 42,  0},{ 8, 0}},
+	{{ 42,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}},
+	{{ 44,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}},
+	{{ 44,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}},
+	{{ 44,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}},
+	{{ 44,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}},
+	{{ 44,  0},{ 8, 0}}, {{ 44,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}},
+	{{ 59,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}},
+	{{ 59,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}},
+	{{ 59,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}},
+	{{ 59,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}},
+	{{ 59,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}}, {{ 59,  0},{ 8, 0}},
+	{{ 88,  0},{ 8, 0}}, {{ 88,  0},{ 8, 0}}, {{ 88,  0},{ 8, 0}},
+	{{ 88,  0},{ 8, 0}}, {{ 88,  0},{ 8, 0}}, {{ 88,  0},{ 8, 0}},
+	{{ 88,  0},{ 8, 0}}, {{ 88,  0},{ 8, 0}}, {{ 88,  0},{ 8, 0}},
+	{{ 88,  0},{ 8, 0}}, {{ 88,  0},{ 8, 0}}, {{ 88,  0},{ 8, 0}},
+	{{ 88,  0},{ 8, 0}}, {{ 88,  0},{ 8, 0}}, {{ 88,  0},{ 8, 0}},
+	{{ 88,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}},
+	{{ 90,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}},
+	{{ 90,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}},
+	{{ 90,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}},
+	{{ 90,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}},
+	{{ 90,  0},{ 8, 0}}, {{ 90,  0},{ 8, 0}}, {{ 33,  0},{10, 0}},
+	{{ 33,  0},{10, 0}}, {{ 33,  0},{10, 0}}, {{ 33,  0},{10, 0}},
+	{{ 34,  0},{10, 0}}, {{ 34,  0},{10, 0}}, {{ 34,  0},{10, 0}},
+	{{ 34,  0},{10, 0}}, {{ 40,  0},{10, 0}}, {{ 40,  0},{10, 0}},
+	{{ 40,  0},{10, 0}}, {{ 40,  0},{10, 0}}, {{ 41,  0},{10, 0}},
+	{{ 41,  0},{10, 0}}, {{ 41,  0},{10, 0}}, {{ 41,  0},{10, 0}},
+	{{ 63,  0},{10, 0}}, {{ 63,  0},{10, 0}}, {{ 63,  0},{10, 0}},
+	{{ 63,  0},{10, 0}}, {{ 39,  0},{11, 0}}, {{ 39,  0},{11, 0}},
+	{{ 43,  0},{11, 0}}, {{ 43,  0},{11, 0}}, {{124,  0},{11, 0}},
+	{{124,  0},{11, 0}}, {{ 35,  0},{12, 0}}, {{ 62,  0},{12, 0}},
+	{{ 86,  0},{ 0, 0}}, {{ 87,  0},{ 0, 0}}, {{ 89,  0},{ 0, 0}},
+	{{ 90,  0},{ 0, 0}},
+};
+#endif /* HPACK_HUFFMAN_TREE */
+
+#endif /* HPACK_HUFFMAN_H */
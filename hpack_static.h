@@ -0,0 +1,66 @@
+/*
+ * THIS FILE IS AUTOMATICALLY GENERATED BY gen/hpackgen.c - DO NOT EDIT.
+ *
+ * Perfect hash of the names in the HPACK static table in hpack.h,
+ * regenerate it with "make tables" in gen/.
+ */
+
+#ifndef HPACK_STATIC_H
+#define HPACK_STATIC_H
+
+#define HPACK_STATIC_HASH_A	18
+#define HPACK_STATIC_HASH_B	105
+#define HPACK_STATIC_HASH_SIZE	128
+
+static const struct hpack_static_name
+    static_names[HPACK_STATIC_HASH_SIZE] = {
+	{ 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0},
+	{ 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0},
+	{ 6,2, 7}, { 0,0, 0}, {18,1,13}, {20,1,27},
+	{ 0,0, 0}, {55,1,10}, { 0,0, 0}, { 0,0, 0},
+	{ 0,0, 0}, {49,1,19}, {39,1, 8}, { 0,0, 0},
+	{ 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {41,1,13},
+	{60,1, 3}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0},
+	{ 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 2,2, 7},
+	{16,1,15}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0},
+	{29,1,16}, { 0,0, 0}, {22,1, 5}, {25,1,19},
+	{ 0,0, 0}, {44,1,13}, { 0,0, 0}, { 0,0, 0},
+	{28,1,14}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0},
+	{ 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {52,1, 7},
+	{35,1, 6}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0},
+	{ 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0},
+	{ 0,0, 0}, { 0,0, 0}, {46,1, 8}, { 1,1,10},
+	{ 0,0, 0}, { 4,2, 5}, {21,1, 3}, { 0,0, 0},
+	{ 0,0, 0}, {26,1,16}, { 8,7, 7}, { 0,0, 0},
+	{ 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0},
+	{36,1, 7}, {51,1, 7}, {17,1,15}, {24,1,13},
+	{56,1,25}, {53,1,11}, { 0,0, 0}, { 0,0, 0},
+	{ 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {42,1, 8},
+	{58,1,10}, { 0,0, 0}, { 0,0, 0}, {61,1,16},
+	{ 0,0, 0}, {34,1, 4}, {54,1, 6}, {48,1,18},
+	{40,1,17}, {47,1,12}, {43,1,19}, { 0,0, 0},
+	{ 0,0, 0}, {37,1, 4}, { 0,0, 0}, { 0,0, 0},
+	{38,1, 4}, {32,1, 6}, { 0,0, 0}, { 0,0, 0},
+	{19,1, 6}, { 0,0, 0}, { 0,0, 0}, {31,1,12},
+	{30,1,13}, {59,1, 4}, { 0,0, 0}, {27,1,16},
+	{15,1,14}, { 0,0, 0}, {50,1, 5}, { 0,0, 0},
+	{57,1,17}, {33,1, 4}, { 0,0, 0}, { 0,0, 0},
+	{ 0,0, 0}, {23,1,13}, { 0,0, 0}, {45,1, 4},
+};
+
+static const struct hpack_static_length
+    static_lengths[HPACK_STATIC_SIZE] = {
+	{10, 0, 1}, { 7, 3, 2}, { 7, 4, 2}, { 5, 1, 4}, { 5,11, 4}, { 7, 4, 6},
+	{ 7, 5, 6}, { 7, 3, 8}, { 7, 3, 8}, { 7, 3, 8}, { 7, 3, 8}, { 7, 3, 8},
+	{ 7, 3, 8}, { 7, 3, 8}, {14, 0,15}, {15,13,16}, {15, 0,17}, {13, 0,18},
+	{ 6, 0,19}, {27, 0,20}, { 3, 0,21}, { 5, 0,22}, {13, 0,23}, {13, 0,24},
+	{19, 0,25}, {16, 0,26}, {16, 0,27}, {14, 0,28}, {16, 0,29}, {13, 0,30},
+	{12, 0,31}, { 6, 0,32}, { 4, 0,33}, { 4, 0,34}, { 6, 0,35}, { 7, 0,36},
+	{ 4, 0,37}, { 4, 0,38}, { 8, 0,39}, {17, 0,40}, {13, 0,41}, { 8, 0,42},
+	{19, 0,43}, {13, 0,44}, { 4, 0,45}, { 8, 0,46}, {12, 0,47}, {18, 0,48},
+	{19, 0,49}, { 5, 0,50}, { 7, 0,51}, { 7, 0,52}, {11, 0,53}, { 6, 0,54},
+	{10, 0,55}, {25, 0,56}, {17, 0,57}, {10, 0,58}, { 4, 0,59}, { 3, 0,60},
+	{16, 0,61},
+};
+
+#endif /* HPACK_STATIC_H */
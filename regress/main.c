@@ -18,6 +18,8 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/uio.h>
 
 #include <limits.h>
 #include <stdarg.h>
@@ -27,20 +29,50 @@
 #include <string.h>
 #include <unistd.h>
 #include <ctype.h>
+#include <errno.h>
 #include <fts.h>
 #include <fnmatch.h>
+#include <time.h>
 
 #include "hpack.h"
 #include "extern.h"
 
+#define BENCH_ROUNDS	10000
+
 static int	 encode_huffman(const char *);
 static int	 decode_huffman(const char *);
+static int	 bench_huffman(const char *);
+static int	 parse_cb(struct hpack_header *, void *);
+static int	 parse_listsize(struct hpack_headerblock *);
+static unsigned char *
+		 encode_data(struct hpack_headerblock *, size_t *,
+		    struct hpack_table *);
+static int	 encode_expect(const char *, const char *,
+		    enum hpack_header_index, const unsigned char *, size_t,
+		    struct hpack_table *);
+static int	 test_encode_int(void);
+static int	 test_encode_nobufs(void);
+static int	 test_validate(void);
+static int	 test_listsize(void);
+static int	 test_fragment_arena(void);
+static int	 test_fragment_truncated(void);
+static int	 keep_cb(struct hpack_header *, void *);
+static int	 decode_error(int);
+static int	 run_tests(void);
 
 int	 verbose;
 int	 encode;
+unsigned int	 flags;
+int	 callback;
+size_t	 fragment;
+size_t	 maxlist;
+int	 encinto;
+size_t	 enciov;
+struct hpack_arena
+	*arena;
 
 static void
-log(int level, const char *fmt, ...)
+logmsg(int level, const char *fmt, ...)
 {
 	va_list	ap;
 
@@ -124,12 +156,18 @@ hpack_headerblock_cmp(struct hpack_headerblock *a,
 		    ONE_NULL(ha->hdr_value, hb->hdr_value))
 			return (-1);
 #undef ONE_NULL
+		/* Strings might be views that are not NUL-terminated */
 		if (ha->hdr_name != NULL &&
-		    strcmp(ha->hdr_name, hb->hdr_name) != 0)
+		    (ha->hdr_namelen != hb->hdr_namelen ||
+		    memcmp(ha->hdr_name, hb->hdr_name, ha->hdr_namelen) != 0))
 			return (-2);
 		if (ha->hdr_value != NULL &&
-		    strcmp(ha->hdr_value, hb->hdr_value) != 0)
+		    (ha->hdr_valuelen != hb->hdr_valuelen ||
+		    memcmp(ha->hdr_value, hb->hdr_value,
+		    ha->hdr_valuelen) != 0))
 			return (-3);
+		if (ha->hdr_token != hb->hdr_token)
+			return (-4);
 	}
 
 	return (0);
@@ -143,14 +181,14 @@ hpack_headerblock_print(const char *prefix, struct hpack_headerblock *hdrs)
 	if (hdrs == NULL)
 		return (0);
 	if (TAILQ_EMPTY(hdrs)) {
-		log(2, "%s: empty headers\n", prefix);
+		logmsg(2, "%s: empty headers\n", prefix);
 		return (-1);
 	}
 
 	TAILQ_FOREACH(hdr, hdrs, hdr_entry) {
 		if (hdr->hdr_name == NULL || hdr->hdr_value == NULL) {
 			if (prefix != NULL)
-				log(2, "%s invalid header: %s: %s\n", prefix,
+				logmsg(2, "%s invalid header: %s: %s\n", prefix,
 				    hdr->hdr_name == NULL ?
 				    "(null)" : hdr->hdr_name,
 				    hdr->hdr_value == NULL ?
@@ -158,8 +196,9 @@ hpack_headerblock_print(const char *prefix, struct hpack_headerblock *hdrs)
 			return (-1);
 		}
 		if (prefix != NULL)
-			log(2, "%s %s: %s\n", prefix,
-			    hdr->hdr_name, hdr->hdr_value);
+			logmsg(2, "%s %.*s: %.*s\n", prefix,
+			    (int)hdr->hdr_namelen, hdr->hdr_name,
+			    (int)hdr->hdr_valuelen, hdr->hdr_value);
 	}
 
 	return (0);
@@ -175,7 +214,7 @@ x2i(const char *s)
 	ss[2] = 0;
 
 	if (!isxdigit(s[0]) || !isxdigit(s[1])) {
-		log(2, "string needs to be specified in hex digits\n");
+		logmsg(2, "string needs to be specified in hex digits\n");
 		return (-1);
 	}
 	return ((int)strtoul(ss, NULL, 16));
@@ -209,23 +248,46 @@ parse_data(unsigned char *buf, size_t len,
     struct hpack_headerblock *test, struct hpack_table *hpack)
 {
 	struct hpack_headerblock	*hdrs = NULL;
+	size_t				 off, n;
 	int				 ret = -1;
 
-	if ((hdrs = hpack_decode(buf, len, hpack)) == NULL) {
-		log(2, "hpack_decode\n");
+	errno = 0;
+	if (fragment) {
+		if ((hdrs = hpack_headerblock_new()) == NULL)
+			goto fail;
+		for (off = 0; off < len; off += n) {
+			if ((n = len - off) > fragment)
+				n = fragment;
+			if (hpack_decode_fragment(buf + off, n,
+			    off + n == len, hpack, parse_cb, hdrs) == -1) {
+				logmsg(2, "hpack_decode_fragment\n");
+				ret = parse_listsize(test);
+				goto fail;
+			}
+		}
+	} else if (callback) {
+		if ((hdrs = hpack_headerblock_new()) == NULL ||
+		    hpack_decode_cb(buf, len, hpack, parse_cb, hdrs) == -1) {
+			logmsg(2, "hpack_decode_cb\n");
+			ret = parse_listsize(test);
+			goto fail;
+		}
+	} else if ((hdrs = hpack_decode(buf, len, hpack)) == NULL) {
+		logmsg(2, "hpack_decode\n");
+		ret = parse_listsize(test);
 		goto fail;
 	}
 
 	if (test != NULL && hpack_headerblock_print(NULL, test) == -1) {
-		log(2, "test headers invalid\n");
+		logmsg(2, "test headers invalid\n");
 		goto fail;
 	}
 	if (hpack_headerblock_print(NULL, hdrs) == -1) {
-		log(2, "parsed headers invalid\n");
+		logmsg(2, "parsed headers invalid\n");
 		goto fail;
 	}
 	if (test != NULL && (ret = hpack_headerblock_cmp(hdrs, test)) != 0) {
-		log(2, "test headers mismatched (returned %d)\n", ret);
+		logmsg(2, "test headers mismatched (returned %d)\n", ret);
 		ret = -1;
 		goto fail;
 	}
@@ -236,10 +298,105 @@ parse_data(unsigned char *buf, size_t len,
 		hpack_headerblock_print(">>> header:", test);
 		hpack_headerblock_print("<<< parsed:", hdrs);
 	}
-	hpack_headerblock_free(hdrs);
+	/* Callbacks copy the headers but their strings use the arena */
+	if (arena == NULL || callback || fragment)
+		hpack_headerblock_free(hdrs);
+	hpack_arena_reset(arena);
 	return (ret);
 }
 
+static int
+parse_listsize(struct hpack_headerblock *test)
+{
+	struct hpack_header	*hdr;
+	size_t			 size = 0;
+
+	if (maxlist == 0 || errno != EMSGSIZE)
+		return (-1);
+
+	/* Decoding is expected to fail if the header list is too large */
+	if (test != NULL) {
+		TAILQ_FOREACH(hdr, test, hdr_entry)
+			size += hdr->hdr_namelen + hdr->hdr_valuelen + 32;
+		if (size <= maxlist)
+			return (-1);
+	}
+	logmsg(2, "header list too large\n");
+
+	return (0);
+}
+
+static int
+parse_cb(struct hpack_header *hdr, void *arg)
+{
+	struct hpack_headerblock	*hdrs = arg;
+	struct hpack_header		*copy;
+
+	/* The header is only valid during the callback */
+	if ((copy = hpack_header_new()) == NULL)
+		return (-1);
+	TAILQ_INSERT_TAIL(hdrs, copy, hdr_entry);
+	if ((copy->hdr_name = strndup(hdr->hdr_name,
+	    hdr->hdr_namelen)) == NULL ||
+	    (copy->hdr_value = strndup(hdr->hdr_value,
+	    hdr->hdr_valuelen)) == NULL)
+		return (-1);
+	copy->hdr_namelen = hdr->hdr_namelen;
+	copy->hdr_valuelen = hdr->hdr_valuelen;
+	copy->hdr_index = hdr->hdr_index;
+	copy->hdr_token = hdr->hdr_token;
+
+	return (0);
+}
+
+static unsigned char *
+encode_data(struct hpack_headerblock *hdrs, size_t *len,
+    struct hpack_table *hpack)
+{
+	struct iovec	 iov[3];
+	unsigned char	*buf;
+	size_t		 size, off;
+	ssize_t		 ret;
+	int		 i;
+
+	if (!encinto && !enciov)
+		return (hpack_encode(hdrs, len, hpack));
+
+	/* Leave room for the 9-byte HTTP/2 frame header */
+	size = hpack_encode_maxlen(hdrs, hpack);
+	if ((buf = malloc(9 + enciov * 2 + size)) == NULL)
+		return (NULL);
+
+	if (enciov) {
+		/* Two small buffers and a last one for the rest */
+		for (i = 0; i < 3; i++) {
+			iov[i].iov_base = buf + 9 + enciov * i;
+			iov[i].iov_len = i < 2 ? enciov : size;
+		}
+		if ((ret = hpack_encode_iov(hdrs, iov, 3, hpack)) == -1)
+			goto fail;
+
+		/* Join the used parts of the buffers */
+		for (i = 0, off = 0; i < 3; i++) {
+			memmove(buf + 9 + off, iov[i].iov_base,
+			    iov[i].iov_len);
+			off += iov[i].iov_len;
+		}
+		if (off != (size_t)ret)
+			goto fail;
+	} else if ((ret = hpack_encode_into(hdrs, buf + 9,
+	    size, hpack)) == -1)
+		goto fail;
+	logmsg(2, "encoded %zd bytes (bound %zu)\n", ret, size);
+
+	memmove(buf, buf + 9, ret);
+	*len = ret;
+	return (buf);
+ fail:
+	free(buf);
+	return (NULL);
+}
+
 static int
 parse_hex(const char *hex, struct hpack_headerblock *test,
     struct hpack_table *hpack)
@@ -248,14 +405,14 @@ parse_hex(const char *hex, struct hpack_headerblock *test,
 	ssize_t				 len;
 
 	if ((len = parsehex(hex, buf, sizeof(buf))) == -1) {
-		log(2, "wire format is not a hex string\n");
+		logmsg(2, "wire format is not a hex string\n");
 		return (-1);
 	}
 
 	if (parse_data(buf, len, test, hpack) == -1)
 		return (-1);
 
-	log(2, ">>> wire: %s\n", hex);
+	logmsg(2, ">>> wire: %s\n", hex);
 	return (0);
 }
 
@@ -276,11 +433,14 @@ parse_input(const char *name, size_t init_table_size)
 
 	if ((hpack = hpack_table_new(init_table_size)) == NULL)
 		goto done;
+	hpack_table_setflags(hpack, flags);
+	hpack_table_setarena(hpack, arena);
+	hpack_table_setmaxlistsize(hpack, maxlist);
 
 	while (fgets(buf, sizeof(buf), fp) != NULL) {
 		buf[strcspn(buf, "\r\n")] = '\0';
 		if (parse_hex(buf, NULL, hpack) == -1) {
-			log(1, "hex HPACK decoding failed\n");
+			logmsg(1, "hex HPACK decoding failed\n");
 			goto done;
 		}
 		ok++;
@@ -327,13 +487,13 @@ parse_raw(const char *name, size_t init_table_size)
 				v = buf;
 			} else
 				v = "";
-			log(2, "adding header '%s: %s'\n", k, v);
+			logmsg(2, "adding header '%s: %s'\n", k, v);
 			if (hpack_header_add(hdrs,
 			    k, v, HPACK_INDEX) == NULL)
 				goto done;
 		}
 		if ((ptr = hpack_encode(hdrs, &len, hpack)) == NULL) {
-			log(1, "raw HPACK decoding failed\n");
+			logmsg(1, "raw HPACK decoding failed\n");
 			goto done;
 		}
 	} else {
@@ -346,7 +506,7 @@ parse_raw(const char *name, size_t init_table_size)
 	}
 
 	if ((hdrs = hpack_decode(ptr, len, hpack)) == NULL) {
-		log(1, "raw HPACK decoding failed\n");
+		logmsg(1, "raw HPACK decoding failed\n");
 		goto done;
 	}
 
@@ -508,6 +668,12 @@ parse_dir(char *argv[], size_t init_table_size)
 					errstr = "failed to get HPACK table";
 					goto done;
 				}
+				hpack_table_setflags(hpack, flags);
+				hpack_table_setflags(hpack2, flags);
+				hpack_table_setarena(hpack, arena);
+				hpack_table_setarena(hpack2, arena);
+				hpack_table_setmaxlistsize(hpack, maxlist);
+				hpack_table_setmaxlistsize(hpack2, maxlist);
 			}
 
 			if (parse_hex(wire, test, hpack) == -1) {
@@ -522,7 +688,7 @@ parse_dir(char *argv[], size_t init_table_size)
 
 			/* Test encoding by re-encoding of the header */
 			free(wire);
-			if ((wire = hpack_encode(test, &len, hpack2)) == NULL) {
+			if ((wire = encode_data(test, &len, hpack2)) == NULL) {
 				errstr = "re-encoding failed";
 				goto done;
 			}
@@ -548,19 +714,19 @@ parse_dir(char *argv[], size_t init_table_size)
 		str = NULL;
 
  next:
-		log(1, "SUCCESS: %s: %zu tests\n", ftsp->fts_path, ok);
+		logmsg(1, "SUCCESS: %s: %zu tests\n", ftsp->fts_path, ok);
 	}
 
 	ret = 0;
  done:
 	if (errstr != NULL && ftsp != NULL && i != 0)
-		log(1, "FAILED: %s: %s in test %zu\n",
+		logmsg(1, "FAILED: %s: %s in test %zu\n",
 		    ftsp->fts_path, errstr, i);
 	else if (errstr != NULL && ftsp != NULL)
-		log(1, "FAILED: %s: %s\n",
+		logmsg(1, "FAILED: %s: %s\n",
 		    ftsp->fts_path, errstr);
 	else if (errstr != NULL)
-		log(1, "FAILED: %s\n", errstr);
+		logmsg(1, "FAILED: %s\n", errstr);
 	free(wire);
 	hpack_table_free(hpack);
 	hpack_table_free(hpack2);
@@ -575,7 +741,7 @@ parse_dir(char *argv[], size_t init_table_size)
 static int
 encode_huffman(const char *name)
 {
-	char				 buf[65535];
+	char				 buf[65535], tmp[65535];
 	char				*enc = NULL, *dec = NULL;
 	FILE				*fp;
 	int				 ret = -1;
@@ -592,14 +758,32 @@ encode_huffman(const char *name)
 	}
 	if ((enc = hpack_huffman_encode(buf, len, &enclen)) == NULL)
 		goto done;
+	if (hpack_huffman_encoded_len(buf, len) != enclen)
+		goto done;
 	if ((dec = hpack_huffman_decode(enc, enclen, &declen)) == NULL)
 		goto done;
 	if (memcmp(dec, buf, len) != 0)
 		goto done;
 
+	/* Decode into a buffer, the first call only returns the size */
+	if (hpack_huffman_decode_into(enc, enclen, NULL, 0) != (ssize_t)len)
+		goto done;
+	if (hpack_huffman_decode_into(enc, enclen, tmp, len) != (ssize_t)len ||
+	    memcmp(tmp, buf, len) != 0)
+		goto done;
+
+	/* Encode into a buffer, nothing is written if it is too small */
+	memset(tmp, 0xff, enclen);
+	if (hpack_huffman_encode_into(buf, len, tmp, enclen - 1) !=
+	    (ssize_t)enclen || tmp[0] != (char)0xff)
+		goto done;
+	if (hpack_huffman_encode_into(buf, len, tmp, enclen) !=
+	    (ssize_t)enclen || memcmp(tmp, enc, enclen) != 0)
+		goto done;
+
 	ret = 0;
  done:
-	log(2, "%s: huffman lengths: raw input %zu,"
+	logmsg(2, "%s: huffman lengths: raw input %zu,"
 	    " encoded output %zu, decoded %zu\n",
 	    ret == 0 ? "SUCCESS": "FAILED" , len, enclen, declen);
 	if (fp != NULL && fp != stdin)
@@ -610,6 +794,445 @@ encode_huffman(const char *name)
 	return (ret);
 }
 
+static int
+encode_expect(const char *name, const char *value,
+    enum hpack_header_index index, const unsigned char *expect, size_t len,
+    struct hpack_table *hpack)
+{
+	struct hpack_headerblock	*hdrs;
+	unsigned char			*wire = NULL;
+	size_t				 wirelen;
+	int				 ret = -1;
+
+	/* The encoded header ends with the expected octets */
+	if ((hdrs = hpack_headerblock_new()) == NULL ||
+	    hpack_header_add(hdrs, name, value, index) == NULL ||
+	    (wire = hpack_encode(hdrs, &wirelen, hpack)) == NULL)
+		goto done;
+	if (wirelen < len || memcmp(wire + wirelen - len, expect, len) != 0) {
+		logmsg(1, "%s: unexpected encoding of %s\n", __func__, name);
+		goto done;
+	}
+
+	ret = 0;
+ done:
+	free(wire);
+	hpack_headerblock_free(hdrs);
+	return (ret);
+}
+
+static int
+test_encode_int(void)
+{
+	struct hpack_headerblock	*hdrs = NULL;
+	struct hpack_table		*hpack = NULL;
+	unsigned char			*wire = NULL, buf[129];
+	unsigned char			 size[] = { 0x3f, 0x00 };
+	char				 name[16], value[128];
+	size_t				 len;
+	int				 i, ret = -1;
+
+	/*
+	 * Integers of 2^N-1 fill the N-bit prefix and need a final
+	 * zero octet.  Fill the dynamic table to get the large indexes.
+	 */
+	if ((hpack = hpack_table_new(4096)) == NULL ||
+	    (hdrs = hpack_headerblock_new()) == NULL)
+		goto done;
+	for (i = 0; i < 66; i++) {
+		(void)snprintf(name, sizeof(name), "h%02d", i);
+		if (hpack_header_add(hdrs, name, "v", HPACK_INDEX) == NULL)
+			goto done;
+	}
+	if ((wire = hpack_encode(hdrs, &len, hpack)) == NULL)
+		goto done;
+
+	/* 7-bit index 127 of the oldest entry */
+	memcpy(buf, "\xff\x00", 2);
+	if (encode_expect("h00", "v", HPACK_INDEX, buf, 2, hpack) == -1)
+		goto done;
+
+	/* 6-bit name index 63 of the second newest entry */
+	memcpy(buf, "\x7f\x00\x01x", 4);
+	if (encode_expect("h64", "x", HPACK_INDEX, buf, 4, hpack) == -1)
+		goto done;
+
+	/* 4-bit name index 15 of the static table */
+	memcpy(buf, "\x1f\x00\x01x", 4);
+	if (encode_expect("accept-charset", "x", HPACK_NEVER_INDEX,
+	    buf, 4, hpack) == -1)
+		goto done;
+
+	/* 7-bit string length 127, not shorter with Huffman code */
+	memset(value, '\\', sizeof(value) - 1);
+	value[sizeof(value) - 1] = '\0';
+	memcpy(buf, "\x7f\x00", 2);
+	memcpy(buf + 2, value, sizeof(value) - 1);
+	if (encode_expect("x-long", value, HPACK_NO_INDEX,
+	    buf, sizeof(buf), hpack) == -1)
+		goto done;
+
+	/* 5-bit table size 31, the encoder does not send size updates */
+	hpack_headerblock_free(hdrs);
+	if ((hdrs = hpack_decode(size, sizeof(size), hpack)) == NULL ||
+	    hpack_table_size(hpack) != 0)
+		goto done;
+
+	ret = 0;
+ done:
+	logmsg(1, "%s: %s\n", ret == 0 ? "SUCCESS" : "FAILED", __func__);
+	free(wire);
+	hpack_headerblock_free(hdrs);
+	hpack_table_free(hpack);
+	return (ret);
+}
+
+static int
+test_encode_nobufs(void)
+{
+	struct hpack_headerblock	*hdrs = NULL;
+	struct hpack_table		*hpack = NULL;
+	unsigned char			 buf[256], *wire = NULL;
+	struct iovec			 iov[3];
+	size_t				 len, size, bound;
+	int				 ret = -1;
+
+	if ((hpack = hpack_table_new(4096)) == NULL ||
+	    (hdrs = hpack_headerblock_new()) == NULL ||
+	    hpack_header_add(hdrs, "x-one", "1", HPACK_INDEX) == NULL ||
+	    hpack_header_add(hdrs, "x-two", "2", HPACK_INDEX) == NULL ||
+	    (wire = hpack_encode(hdrs, &len, hpack)) == NULL)
+		goto done;
+
+	/* A new header would be added to the table */
+	if (hpack_header_add(hdrs, "x-three", "3", HPACK_INDEX) == NULL)
+		goto done;
+	size = hpack_table_size(hpack);
+	if ((bound = hpack_encode_maxlen(hdrs, hpack)) > sizeof(buf))
+		goto done;
+
+	/* Buffers that are smaller than the bound leave the table as is */
+	errno = 0;
+	if (hpack_encode_into(hdrs, buf, bound - 1, hpack) != -1 ||
+	    errno != ENOBUFS || hpack_table_size(hpack) != size)
+		goto done;
+	iov[0].iov_base = buf;
+	iov[0].iov_len = 1;
+	iov[1].iov_base = buf + 1;
+	iov[1].iov_len = 1;
+	iov[2].iov_base = buf + 2;
+	iov[2].iov_len = bound - 3;
+	errno = 0;
+	if (hpack_encode_iov(hdrs, iov, 3, hpack) != -1 ||
+	    errno != ENOBUFS || hpack_table_size(hpack) != size)
+		goto done;
+	errno = 0;
+	if (hpack_encode_iov(hdrs, iov, 0, hpack) != -1 ||
+	    errno != EINVAL || hpack_table_size(hpack) != size)
+		goto done;
+
+	/* The headers fit into the bound */
+	if (hpack_encode_into(hdrs, buf, bound, hpack) == -1 ||
+	    hpack_table_size(hpack) <= size)
+		goto done;
+
+	ret = 0;
+ done:
+	logmsg(1, "%s: %s\n", ret == 0 ? "SUCCESS" : "FAILED", __func__);
+	free(wire);
+	hpack_headerblock_free(hdrs);
+	hpack_table_free(hpack);
+	return (ret);
+}
+
+static int
+test_validate(void)
+{
+	struct {
+		const char	*hex;
+		int		 error;
+	} tests[] = {
+		/* Valid fields with a pseudo-header first, SP, and HTAB */
+		{ "820001610178",		0 },
+		{ "00016103782078",		0 },
+		{ "00016103780978",		0 },
+		/* Uppercase name, raw and Huffman-coded */
+		{ "0001410178",			EILSEQ },
+		{ "0081870178",			EILSEQ },
+		/* CR, LF, and NUL in the value */
+		{ "00016102780d",		EILSEQ },
+		{ "00016102780a",		EILSEQ },
+		{ "000161027800",		EILSEQ },
+		/* Stray colon in the name */
+		{ "0003613a620178",		EILSEQ },
+		/* Leading SP and trailing HTAB in the value */
+		{ "000161022078",		EILSEQ },
+		{ "000161027809",		EILSEQ },
+		/* Pseudo-header after a regular field */
+		{ "000161017882",		EBADMSG },
+		/* Indexed invalid entry, which is still added to the table */
+		{ "4001410178",			EILSEQ },
+		{ "be",				EILSEQ },
+		/* An invalid index after an invalid value is a decoding error */
+		{ "00016102780dbf",		-1 },
+		{ NULL,				0 }
+	};
+	struct hpack_headerblock	*hdrs;
+	struct hpack_table		*hpack = NULL;
+	unsigned char			 buf[64];
+	unsigned int			 modes[] = {
+		HPACK_TABLE_F_VALIDATE,
+		HPACK_TABLE_F_VALIDATE|HPACK_TABLE_F_VIEW
+	};
+	ssize_t				 len;
+	size_t				 i, j;
+	int				 ret = -1;
+
+	for (j = 0; j < sizeof(modes) / sizeof(modes[0]); j++) {
+		if ((hpack = hpack_table_new(4096)) == NULL)
+			goto done;
+		hpack_table_setflags(hpack, modes[j]);
+
+		for (i = 0; tests[i].hex != NULL; i++) {
+			if ((len = parsehex(tests[i].hex,
+			    buf, sizeof(buf))) == -1)
+				goto done;
+
+			errno = 0;
+			hdrs = hpack_decode(buf, len, hpack);
+			hpack_headerblock_free(hdrs);
+			if ((hdrs == NULL ? decode_error(errno) : 0) !=
+			    tests[i].error) {
+				logmsg(2, "%s: %s: errno %d, expected %d\n",
+				    __func__, tests[i].hex, errno,
+				    tests[i].error);
+				goto done;
+			}
+		}
+		hpack_table_free(hpack);
+		hpack = NULL;
+	}
+
+	ret = 0;
+ done:
+	logmsg(1, "%s: %s\n", ret == 0 ? "SUCCESS" : "FAILED", __func__);
+	hpack_table_free(hpack);
+	return (ret);
+}
+
+static int
+test_listsize(void)
+{
+	struct {
+		const char	*hex;
+		int		 error;
+	} tests[] = {
+		/* A 61-byte value exceeds the limit of 50 bytes */
+		{ "0001613c"
+		  "616161616161616161616161616161616161616161616161616161616161"
+		  "616161616161616161616161616161616161616161616161616161616161",
+		  EMSGSIZE },
+		/* An invalid index after it is a decoding error */
+		{ "0001613c"
+		  "616161616161616161616161616161616161616161616161616161616161"
+		  "616161616161616161616161616161616161616161616161616161616161"
+		  "bf",
+		  -1 },
+		/* The limit applies to each header block */
+		{ "0001610178",			0 },
+		{ NULL,				0 }
+	};
+	struct hpack_headerblock	*hdrs;
+	struct hpack_table		*hpack = NULL;
+	unsigned char			 buf[128];
+	ssize_t				 len;
+	size_t				 i;
+	int				 ret = -1;
+
+	if ((hpack = hpack_table_new(4096)) == NULL)
+		goto done;
+	hpack_table_setmaxlistsize(hpack, 50);
+
+	for (i = 0; tests[i].hex != NULL; i++) {
+		if ((len = parsehex(tests[i].hex, buf, sizeof(buf))) == -1)
+			goto done;
+
+		errno = 0;
+		hdrs = hpack_decode(buf, len, hpack);
+		hpack_headerblock_free(hdrs);
+		if ((hdrs == NULL ? decode_error(errno) : 0) !=
+		    tests[i].error) {
+			logmsg(2, "%s: %s: errno %d, expected %d\n",
+			    __func__, tests[i].hex, errno, tests[i].error);
+			goto done;
+		}
+	}
+
+	ret = 0;
+ done:
+	logmsg(1, "%s: %s\n", ret == 0 ? "SUCCESS" : "FAILED", __func__);
+	hpack_table_free(hpack);
+	return (ret);
+}
+
+static int
+test_fragment_arena(void)
+{
+	/* A literal with a new name, "x-a: hello-world" */
+	const char			*hex = "0003782d610b68656c6c6f2d776f726c64";
+	struct hpack_header		 hdr;
+	struct hpack_table		*hpack = NULL;
+	struct hpack_arena		*harena = NULL;
+	unsigned char			 buf[64];
+	ssize_t				 len;
+	size_t				 n;
+	int				 ret = -1;
+
+	if ((len = parsehex(hex, buf, sizeof(buf))) == -1 ||
+	    (harena = hpack_arena_new(0)) == NULL ||
+	    (hpack = hpack_table_new(4096)) == NULL)
+		goto done;
+	hpack_table_setarena(hpack, harena);
+	hpack_table_setflags(hpack, HPACK_TABLE_F_VIEW);
+
+	/* Strings of split fields must outlive the callback */
+	for (n = 1; n < (size_t)len; n++) {
+		memset(&hdr, 0, sizeof(hdr));
+		if (hpack_decode_fragment(buf, n, 0, hpack,
+		    keep_cb, &hdr) == -1 ||
+		    hpack_decode_fragment(buf + n, len - n, 1, hpack,
+		    keep_cb, &hdr) == -1)
+			goto done;
+		if (hdr.hdr_namelen != 3 || hdr.hdr_valuelen != 11 ||
+		    memcmp(hdr.hdr_name, "x-a", 3) != 0 ||
+		    memcmp(hdr.hdr_value, "hello-world", 11) != 0) {
+			logmsg(2, "%s: split at %zu: header mismatch\n",
+			    __func__, n);
+			goto done;
+		}
+		hpack_arena_reset(harena);
+	}
+
+	ret = 0;
+ done:
+	logmsg(1, "%s: %s\n", ret == 0 ? "SUCCESS" : "FAILED", __func__);
+	hpack_table_free(hpack);
+	hpack_arena_free(harena);
+	return (ret);
+}
+
+static int
+test_fragment_truncated(void)
+{
+	const char			*tests[] = {
+		/* Oversized value that is skipped, truncated */
+		"00016179e906616263",
+		/* Oversized name that is skipped, truncated */
+		"0079616263",
+		/* Indexed literal that is buffered, truncated */
+		"400161056162",
+		/* Complete block */
+		"4001610161",
+		NULL
+	};
+	struct hpack_headerblock	*hdrs = NULL;
+	struct hpack_table		*hpack = NULL;
+	unsigned char			 buf[64];
+	ssize_t				 len;
+	size_t				 i, n, size;
+	int				 ret = -1, error, r;
+
+	/* Fragments and complete blocks fail with the same errors */
+	for (i = 0; tests[i] != NULL; i++) {
+		if ((len = parsehex(tests[i], buf, sizeof(buf))) == -1 ||
+		    (hpack = hpack_table_new(4096)) == NULL)
+			goto done;
+		hpack_table_setmaxlistsize(hpack, 100);
+		errno = 0;
+		hdrs = hpack_decode(buf, len, hpack);
+		error = hdrs == NULL ? decode_error(errno) : 0;
+		size = hpack_table_size(hpack);
+		hpack_headerblock_free(hdrs);
+		hdrs = NULL;
+		hpack_table_free(hpack);
+		hpack = NULL;
+
+		for (n = 1; n <= (size_t)len; n++) {
+			if ((hpack = hpack_table_new(4096)) == NULL ||
+			    (hdrs = hpack_headerblock_new()) == NULL)
+				goto done;
+			hpack_table_setmaxlistsize(hpack, 100);
+			errno = 0;
+			if ((r = hpack_decode_fragment(buf, n, n == (size_t)len,
+			    hpack, parse_cb, hdrs)) == 0 && n < (size_t)len)
+				r = hpack_decode_fragment(buf + n, len - n, 1,
+				    hpack, parse_cb, hdrs);
+			if ((r == -1 ? decode_error(errno) : 0) != error ||
+			    hpack_table_size(hpack) != size) {
+				logmsg(2, "%s: %s: split at %zu: errno %d, "
+				    "expected %d\n", __func__, tests[i], n,
+				    errno, error);
+				goto done;
+			}
+			hpack_headerblock_free(hdrs);
+			hdrs = NULL;
+			hpack_table_free(hpack);
+			hpack = NULL;
+		}
+	}
+
+	ret = 0;
+ done:
+	logmsg(1, "%s: %s\n", ret == 0 ? "SUCCESS" : "FAILED", __func__);
+	hpack_headerblock_free(hdrs);
+	hpack_table_free(hpack);
+	return (ret);
+}
+
+static int
+keep_cb(struct hpack_header *hdr, void *arg)
+{
+	/* Keep the strings, which are allocated from the arena */
+	memcpy(arg, hdr, sizeof(*hdr));
+	return (0);
+}
+
+static int
+decode_error(int error)
+{
+	/* Other errors than these are decoding errors */
+	switch (error) {
+	case EMSGSIZE:
+	case EILSEQ:
+	case EBADMSG:
+		return (error);
+	default:
+		break;
+	}
+	return (-1);
+}
+
+static int
+run_tests(void)
+{
+	int	 ret = 0;
+
+	if (test_encode_int() == -1)
+		ret = -1;
+	if (test_encode_nobufs() == -1)
+		ret = -1;
+	if (test_validate() == -1)
+		ret = -1;
+	if (test_listsize() == -1)
+		ret = -1;
+	if (test_fragment_arena() == -1)
+		ret = -1;
+	if (test_fragment_truncated() == -1)
+		ret = -1;
+
+	return (ret);
+}
+
 static int
 decode_huffman(const char *name)
 {
@@ -637,7 +1260,7 @@ decode_huffman(const char *name)
 
 	ret = 0;
  done:
-	log(2, "%s: huffman lengths: raw input %zu,"
+	logmsg(2, "%s: huffman lengths: raw input %zu,"
 	    " decoded output %zu, encoded %zu\n",
 	    ret == 0 ? "SUCCESS": "FAILED" , len, declen, enclen);
 	if (fp != NULL && fp != stdin)
@@ -648,13 +1271,71 @@ decode_huffman(const char *name)
 	return (ret);
 }
 
+static int
+bench_huffman(const char *name)
+{
+	char				 buf[65535];
+	char				*enc = NULL, *dec = NULL;
+	FILE				*fp;
+	int				 ret = -1;
+	size_t				 len = 0, enclen = 0, declen = 0, i;
+	struct timespec			 start, end, elapsed;
+	double				 secs;
+
+	if (strcmp("-", name) == 0)
+		fp = stdin;
+	else if ((fp = fopen(name, "r")) == NULL)
+		goto done;
+	if ((len = fread(buf, 1, sizeof(buf), fp)) < 1)
+		goto done;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		free(enc);
+		if ((enc = hpack_huffman_encode(buf, len, &enclen)) == NULL)
+			goto done;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	timespecsub(&end, &start, &elapsed);
+
+	secs = elapsed.tv_sec + elapsed.tv_nsec / 1000000000.0;
+	logmsg(0, "%s: huffman encoding %zu bytes, %d rounds:"
+	    " %.3f seconds, %.2f MB/s\n", name, len, BENCH_ROUNDS,
+	    secs, secs > 0 ? (double)len * BENCH_ROUNDS / secs / 1048576 : 0);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		if ((dec = hpack_huffman_decode(enc, enclen, &declen)) == NULL)
+			goto done;
+		free(dec);
+		dec = NULL;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	timespecsub(&end, &start, &elapsed);
+
+	secs = elapsed.tv_sec + elapsed.tv_nsec / 1000000000.0;
+	logmsg(0, "%s: huffman decoding %zu bytes, %d rounds:"
+	    " %.3f seconds, %.2f MB/s\n", name, enclen, BENCH_ROUNDS,
+	    secs, secs > 0 ? (double)enclen * BENCH_ROUNDS / secs / 1048576 : 0);
+
+	ret = 0;
+ done:
+	if (fp != NULL && fp != stdin)
+		fclose(fp);
+	free(enc);
+	free(dec);
+
+	return (ret);
+}
+
 static __dead void
 usage(void)
 {
 	extern char	*__progname;
 
-	fprintf(stderr, "usage: %s [-d|e file] [-h hex] [-p input-file]"
-	    " [-r raw-file] [-x hex] [dir ...]\n", __progname);
+	fprintf(stderr, "usage: %s [-ACEISTVv] [-b|d|e file] [-F size] [-h hex]"
+	    " [-i input-file] [-L size] [-r raw-file] [-W size] [dir ...]\n",
+	    __progname);
 	exit(1);
 }
 
@@ -662,14 +1343,26 @@ int
 main(int argc, char *argv[])
 {
 	const char	*hex = NULL, *input = NULL, *raw = NULL;
-	const char	*huffenc = NULL, *huffdec = NULL;
-	int		 ch, ret;
+	const char	*huffenc = NULL, *huffdec = NULL, *huffbench = NULL;
+	const char	*errstr;
+	int		 ch, ret, tests = 0;
 
 	if (hpack_init() == -1)
 		return (1);
 
-	while ((ch = getopt(argc, argv, "d:Ee:h:i:r:v")) != -1) {
+	while ((ch = getopt(argc, argv, "Ab:Cd:Ee:F:h:Ii:L:r:STVvW:")) != -1) {
 		switch (ch) {
+		case 'A':
+			if (arena == NULL &&
+			    (arena = hpack_arena_new(0)) == NULL)
+				return (1);
+			break;
+		case 'b':
+			huffbench = optarg;
+			break;
+		case 'C':
+			callback = 1;
+			break;
 		case 'd':
 			huffdec = optarg;
 			break;
@@ -679,18 +1372,45 @@ main(int argc, char *argv[])
 		case 'e':
 			huffenc = optarg;
 			break;
+		case 'F':
+			fragment = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				usage();
+			break;
 		case 'h':
 			hex = optarg;
 			break;
+		case 'I':
+			encinto = 1;
+			break;
 		case 'i':
 			input = optarg;
 			break;
+		case 'L':
+			maxlist = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				usage();
+			break;
 		case 'r':
 			raw = optarg;
 			break;
+		case 'S':
+			flags |= HPACK_TABLE_F_VALIDATE;
+			break;
+		case 'T':
+			tests = 1;
+			break;
+		case 'V':
+			flags |= HPACK_TABLE_F_VIEW;
+			break;
 		case 'v':
 			verbose++;
 			break;
+		case 'W':
+			enciov = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				usage();
+			break;
 		default:
 			usage();
 		}
@@ -698,7 +1418,11 @@ main(int argc, char *argv[])
 	argc -= optind;
 	argv += optind;
 
-	if (huffdec != NULL)
+	if (tests)
+		ret = run_tests();
+	else if (huffbench != NULL)
+		ret = bench_huffman(huffbench);
+	else if (huffdec != NULL)
 		ret = decode_huffman(huffdec);
 	else if (huffenc != NULL)
 		ret = encode_huffman(huffenc);
@@ -712,6 +1436,7 @@ main(int argc, char *argv[])
 		ret = parse_dir(argv, 4096);
 	else
 		usage();
+	hpack_arena_free(arena);
 	if (ret == -1)
 		return (1);
 